@@ -34,6 +34,8 @@
                   [--event-record-print-level level]
                   [--mc-job-status-refresh-rate  rate]
                   [--cache-file root_file]
+                  [--event-output-queue n]
+                  [--recycle-event-records]
                   [--xml-path config_xml_dir]
                   [--tune G18_02a_00_000] (or your preferred tune identifier)
 
@@ -106,6 +108,13 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --event-output-queue
+              Writes events asynchronously, from a separate I/O thread, with
+              up to n events waiting to be written before event generation
+              pauses. [default: 0, events are written synchronously]
+           --recycle-event-records
+              Reuses the event records (and their particle entries) of
+              written events instead of allocating new ones for each event.
            --xml-path
               A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
 
@@ -322,11 +331,10 @@ void GenerateEventsAtFixedInitState(void)
      LOG("gevgen", pNOTICE)
         << "Generated Event GHEP Record: " << *event;
 
-     // add event at the output ntuple, refresh the mc job monitor & clean up
-     ntpw.AddEventRecord(ievent, event);
+     // refresh the mc job monitor & hand the event over to the output ntuple
      mcjmonitor.Update(ievent,event);
+     ntpw.AdoptEventRecord(ievent, event);
      ievent++;
-     delete event;
   }
 
   // Save the generated MC events
@@ -383,11 +391,10 @@ void GenerateEventsUsingFluxOrTgtMix(void)
 
      LOG("gevgen", pNOTICE) << "Generated Event GHEP Record: " << *event;
 
-     // add event at the output ntuple, refresh the mc job monitor & clean-up
-     ntpw.AddEventRecord(ievent, event);
+     // refresh the mc job monitor & hand the event over to the output ntuple
      mcjmonitor.Update(ievent,event);
+     ntpw.AdoptEventRecord(ievent, event);
      ievent++;
-     delete event;
   }
 
   // Save the generated MC events
@@ -795,6 +802,8 @@ void PrintSyntax(void)
     << "\n              [--event-record-print-level level]"
     << "\n              [--mc-job-status-refresh-rate  rate]"
     << "\n              [--cache-file root_file]"
+    << "\n              [--event-output-queue n]"
+    << "\n              [--recycle-event-records]"
     << "\n              [--xml-path config_xml_dir]"
     << "\n              [--tune G18_02a_00_000] (or your preferred tune identifier)"
     << "\n";
@@ -38,6 +38,7 @@
                        [-z zmin]
                        [-d debug flags]
                        [--seed random_number_seed]
+                       [--workers n_of_worker_processes]
                         --cross-sections xml_file
                        [--event-generator-list list_name]
                        [--tune genie_tune]
@@ -46,6 +47,7 @@
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
                        [--cache-file root_file]
+                       [--event-output-queue n]
 
          *** Options :
 
@@ -206,6 +208,19 @@
               This cmd line arguments lets you override 'gntp'
            --seed
               Random number seed.
+           --workers
+              Number of event generation worker processes. The job is
+              configured once (splines, geometry, hadron transport tables)
+              and then forked, so all workers share that state. Worker k
+              generates events k, k+n, k+2n, ... using independent
+              counter-based random number streams positioned at each event,
+              so that any event can be regenerated independently of the
+              number of workers. Each worker writes its
+              own output file ([prefix].w[k].[run_number].ghep.root for k>0)
+              and the requested exposure is divided evenly among the workers.
+              Only available for flux histograms (see option -f) and
+              without a --cache-file.
+              [default: single process, no per-event re-seeding]
            --cross-sections
               Name (incl. full path) of an XML file with pre-computed
               cross-section values used for constructing splines.
@@ -228,6 +243,11 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --event-output-queue
+              Accepted for consistency with gevgen, but ignored: the flux
+              pass-through branches added to the output tree are filled from
+              buffers that the flux driver overwrites for the next neutrino,
+              so events are always written synchronously.
 
          *** Examples:
 
@@ -390,6 +410,7 @@ double          gOptZmin = -2.0e30;            // starting z position [ if abs()
 string          gOptEvFilePrefix;              // event file prefix
 int             gOptDebug = 0;                 // debug flags
 long int        gOptRanSeed;                   // random number seed
+int             gOptNWorkers = 0;              // number of worker processes (0: option not set)
 string          gOptInpXSecFile;               // cross-section splines
 
 bool            gSigTERM = false;              // was TERM signal sent?
@@ -412,6 +433,19 @@ int main(int argc, char ** argv)
   }
   RunOpt::Instance()->BuildTune();
 
+  // Worker processes share the file descriptors opened before they are
+  // forked: only allow them when no input is streamed from (and no cache is
+  // written to) a ROOT file during event generation
+  if ( gOptNWorkers > 1 ) {
+    bool has_cache = RunOpt::Instance()->CacheFile().size() > 0;
+    if ( ! gOptUsingHistFlux || has_cache ) {
+      LOG("gevgen_fnal", pFATAL)
+        << "Worker processes are only supported for histogram-based fluxes "
+        << "and without a --cache-file";
+      exit(1);
+    }
+  }
+
   // Initialization of random number generators, cross-section table,
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
@@ -648,13 +682,29 @@ int main(int argc, char ** argv)
     }
   }
 
+  // *************************************************************************
+  // * Split the job in worker processes, if requested
+  // *************************************************************************
+  bool use_event_seeds = (gOptNWorkers > 0);
+  int  nworkers        = TMath::Max(1, gOptNWorkers);
+  int  iworker         = mcj_driver->ForkWorkers(nworkers);
+
+  // With per-event seeds each GENIE module draws from its own counter-based
+  // stream, so an event is fully determined by (seed, event index)
+  if ( use_event_seeds ) {
+    RandomGen::Instance()->UseCounterBasedStreams(true);
+  }
+
+  ostringstream worker_tag;
+  if ( iworker > 0 ) worker_tag << ".w" << iworker;
+
   // *************************************************************************
   // * Prepare for writing the output event tree & status file
   // *************************************************************************
 
   // Initialize an Ntuple Writer to save GHEP records into a TTree
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix + worker_tag.str());
   ntpw.Initialize();
 
 
@@ -703,6 +753,11 @@ int main(int argc, char ** argv)
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+  if ( iworker > 0 ) {
+    ostringstream status_file;
+    status_file << "genie-mcjob-" << gOptRunNu << worker_tag.str() << ".status";
+    mcjmonitor.CustomizeFilename(status_file.str());
+  }
 
   // *************************************************************************
   // * Event generation loop
@@ -711,7 +766,12 @@ int main(int argc, char ** argv)
   // define handler to allow signal to end job gracefully
   signal(SIGTERM,gsSIGTERMhandler);
 
-  int ievent = 0;
+  // each worker generates the events with index = iworker (mod nworkers)
+  // and is responsible for an equal share of the requested exposure
+  double pot_target = gOptPOT / nworkers;
+
+  int ievent = iworker;
+  int nev_generated = 0;
   while ( ! gSigTERM )
   {
      LOG("gevgen_fnal", pINFO)
@@ -719,7 +779,7 @@ int main(int argc, char ** argv)
 
      // In case the required statistics was expressed as 'number of events'
      // then quit if that number has been generated
-     if ( ievent == gOptNev ) break;
+     if ( gOptNev >= 0 && ievent >= gOptNev ) break;
 
      // In case the required statistics was expressed as 'number of POT'
      // then exit the event loop if the requested POT has been generated.
@@ -727,12 +787,13 @@ int main(int argc, char ** argv)
         double fpot = fluxExposureI->GetTotalExposure(); // current POTs used
         double psc  = mcj_driver->GlobProbScale();  // interaction prob. scale
         double pot  = fpot / psc;                   // POTs for generated sample
-        if ( pot >= gOptPOT ) break;
+        if ( pot >= pot_target ) break;
      }
 
      // Generate a single event using neutrinos coming from the specified flux
      // and hitting the specified geometry or target mix
-     EventRecord * event = mcj_driver->GenerateEvent();
+     EventRecord * event = (use_event_seeds) ?
+         mcj_driver->GenerateEvent(ievent) : mcj_driver->GenerateEvent();
 
      // Check whether a null event was returned due to the flux driver reaching
      // the end of the input flux ntuple - exit the event generation loop
@@ -758,7 +819,8 @@ int main(int argc, char ** argv)
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
      delete event;
-     ievent++;
+     ievent += nworkers;
+     nev_generated++;
 
   } //1
 
@@ -809,7 +871,7 @@ int main(int argc, char ** argv)
        LOG("gevgen_fnal", pFATAL) << "MCJobDriver GlobalProbScale was " << psc;
     }
     double pot   = fpot / psc;                       // POT for generated sample
-    long int nev = ievent;
+    long int nev = nev_generated;
 
     LOG("gevgen_fnal", pNOTICE)
         << "\n >> Interaction probability scaling factor:  " << psc
@@ -831,6 +893,12 @@ int main(int argc, char ** argv)
   // Save the generated event tree & close the output file
   ntpw.Save();
 
+  // The parent process waits for all workers to finish before exiting
+  if ( iworker == 0 && ! mcj_driver->WaitForWorkers() ) {
+    LOG("gevgen_fnal", pERROR)
+      << "At least one event generation worker did not finish cleanly";
+  }
+
   // Clean-up
   delete geom_driver;
   delete flux_driver;
@@ -1143,6 +1211,20 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // number of event generation worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = parser.ArgAsInt("workers");
+    if ( gOptNWorkers < 1 ) {
+      LOG("gevgen_fnal", pFATAL)
+        << "Invalid number of worker processes: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    gOptNWorkers = 0;
+  }
+
   // input cross-section file
   if( parser.OptionExists("cross-sections") ) {
     LOG("gevgen_fnal", pINFO) << "Reading cross-section file";
@@ -1263,6 +1345,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_fnal", pNOTICE)
      << "\n - Run number: " << gOptRunNu
      << "\n - Random number seed: " << gOptRanSeed
+     << "\n - Worker processes: " << TMath::Max(1, gOptNWorkers)
      << "\n - Using cross-section file: " << gOptInpXSecFile
      << "\n - Flux     @ " << fluxinfo.str()
      << "\n - Geometry @ " << gminfo.str()
@@ -1284,6 +1367,7 @@ void PrintSyntax(void)
    << "\n            [-F fid_cut_string] [-S nrays_scan]"
    << "\n            [-z zmin_start]"
    << "\n            [--seed random_number_seed]"
+   << "\n            [--workers n_of_worker_processes]"
    << "\n             --cross-sections xml_file"
    << "\n            [--event-generator-list list_name]"
    << "\n            [--message-thresholds xml_file]"
@@ -1291,6 +1375,7 @@ void PrintSyntax(void)
    << "\n            [--event-record-print-level level]"
    << "\n            [--mc-job-status-refresh-rate  rate]"
    << "\n            [--cache-file root_file]"
+   << "\n            [--event-output-queue n]"
    << "\n"
    << " Please also read the detailed documentation at "
    << "$GENIE/src/Apps/gFNALExptEvGen.cxx"
@@ -18,6 +18,7 @@
                   [-e max_energy]
                   [--no-copy]
                   [--seed random_number_seed]
+                  [--workers n_of_worker_processes]
                   [--input-cross-sections xml_file]
                   [--event-generator-list list_name]
                   [--tune genie_tune]
@@ -52,6 +53,14 @@
                Does not write out the input cross-sections in the output file
            --seed
               Random number seed.
+           --workers
+              Number of worker processes building splines in parallel.
+              Each spline is built by one worker, chosen based on the spline
+              key, and the splines are merged in the output file, which does
+              not depend on the number of workers. Splines for free nucleon
+              targets are built first, so that they can be used for building
+              the nuclear target splines.
+              [default: 1]
            --input-cross-sections
               Name (incl. full path) of an XML file with pre-computed
               free-nucleon cross-section values. If loaded, it can speed-up
@@ -87,6 +96,7 @@
 #include <cstdlib>
 #include <string>
 #include <vector>
+#include <sstream>
 
 #if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
 #include <fenv.h> // for `feenableexcept`
@@ -100,10 +110,11 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/StringUtils.h"
-//#include "Framework/Utils/SystemUtils.h"
+#include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/CmdLnArgParser.h"
@@ -114,6 +125,7 @@
 
 using std::string;
 using std::vector;
+using std::ostringstream;
 
 using namespace genie;
 
@@ -126,6 +138,9 @@ void          GetCommandLineArgs (int argc, char ** argv);
 void          PrintSyntax        (void);
 PDGCodeList * GetNeutrinoCodes   (void);
 PDGCodeList * GetTargetCodes     (void);
+void          MakeSplines        (const PDGCodeList & nus, const vector<int> & tgts);
+bool          MakeSplinesInWorkers
+                                 (const PDGCodeList & nus, const vector<int> & tgts);
 
 // User-specified options:
 string   gOptNuPdgCodeList  = "";
@@ -137,6 +152,7 @@ bool     gOptNoCopy         = false;
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
+int      gOptNWorkers       = 1;    // number of worker processes
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -183,10 +199,44 @@ int main(int argc, char ** argv)
   // to build splines for all the interactions that its loaded list
   // of event generators can generate.
 
-  PDGCodeList::const_iterator nuiter;
-  PDGCodeList::const_iterator tgtiter;
-  for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
+  if(gOptNWorkers <= 1) {
+    vector<int> tgts(targets->begin(), targets->end());
+    MakeSplines(*neutrinos, tgts);
+  }
+  else {
+    // Build the free nucleon splines first, as they are used for computing
+    // nuclear cross sections, and then the nuclear ones
+    vector<int> free_nuc_tgts, nuclear_tgts;
+    PDGCodeList::const_iterator tgtiter;
     for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
+      if(pdg::IonPdgCodeToA(*tgtiter) == 1) free_nuc_tgts.push_back(*tgtiter);
+      else                                  nuclear_tgts .push_back(*tgtiter);
+    }
+    bool ok = MakeSplinesInWorkers(*neutrinos, free_nuc_tgts) &&
+              MakeSplinesInWorkers(*neutrinos, nuclear_tgts);
+    if(!ok) {
+      LOG("gmkspl", pFATAL) << "Spline building failed in a worker process";
+      exit(1);
+    }
+  }
+
+  // Save the splines at the requested XML file
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  bool save_init = !gOptNoCopy;
+  xspl->SaveAsXml(gOptOutXSecFile, save_init);
+
+  delete neutrinos;
+  delete targets;
+
+  return 0;
+}
+//____________________________________________________________________________
+void MakeSplines(const PDGCodeList & nus, const vector<int> & tgts)
+{
+  PDGCodeList::const_iterator nuiter;
+  vector<int>::const_iterator tgtiter;
+  for(nuiter = nus.begin(); nuiter != nus.end(); ++nuiter) {
+    for(tgtiter = tgts.begin(); tgtiter != tgts.end(); ++tgtiter) {
       int nupdgc  = *nuiter;
       int tgtpdgc = *tgtiter;
       InitialState init_state(tgtpdgc, nupdgc);
@@ -196,16 +246,49 @@ int main(int argc, char ** argv)
       driver.CreateSplines(gOptNKnots, gOptMaxE);
     }
   }
+}
+//____________________________________________________________________________
+bool MakeSplinesInWorkers(const PDGCodeList & nus, const vector<int> & tgts)
+{
+// Builds the splines for the input initial states in gOptNWorkers processes.
+// Each worker builds its share of splines (see XSecSplineList::SetWorker)
+// and saves them in a temporary XML file, which is then merged by the parent.
+
+  if(tgts.size() == 0) return true;
 
-  // Save the splines at the requested XML file
   XSecSplineList * xspl = XSecSplineList::Instance();
-  bool save_init = !gOptNoCopy;
-  xspl->SaveAsXml(gOptOutXSecFile, save_init);
 
-  delete neutrinos;
-  delete targets;
+  vector<int> pids;
+  int iworker = utils::system::ForkWorkers(gOptNWorkers, pids);
 
-  return 0;
+  xspl->SetWorker(gOptNWorkers, iworker);
+  MakeSplines(nus, tgts);
+
+  if(iworker > 0) {
+    // saves only the splines built by this worker in this round
+    ostringstream filename;
+    filename << gOptOutXSecFile << ".worker" << iworker << ".xml";
+    xspl->SaveAsXml(filename.str(), false);
+    exit(0);
+  }
+  xspl->SetWorker(1, 0);
+
+  bool ok = utils::system::WaitForWorkers(pids);
+
+  for(int iw = 1; iw < gOptNWorkers; iw++) {
+    ostringstream filename;
+    filename << gOptOutXSecFile << ".worker" << iw << ".xml";
+    if(!utils::system::FileExists(filename.str())) {
+      LOG("gmkspl", pERROR) << "Missing worker output: " << filename.str();
+      ok = false;
+      continue;
+    }
+    LOG("gmkspl", pNOTICE) << "Merging splines from: " << filename.str();
+    XmlParserStatus_t status = xspl->LoadFromXml(filename.str(), true, false);
+    if(status != kXmlOK) ok = false;
+    gSystem->Unlink(filename.str().c_str());
+  }
+  return ok;
 }
 //____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
@@ -317,6 +400,20 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gmkspl", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = parser.ArgAsInt("workers");
+    if(gOptNWorkers < 1) {
+      LOG("gmkspl", pFATAL)
+        << "Invalid number of worker processes: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    gOptNWorkers = 1;
+  }
+
   // input cross-section file
   if( parser.OptionExists("input-cross-sections") ) {
     LOG("gmkspl", pINFO) << "Reading cross-section file";
@@ -338,6 +435,7 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n Output cross-section file : " << gOptOutXSecFile
      << "\n Input cross-section file : " << gOptInpXSecFile
      << "\n Random number seed : " << gOptRanSeed
+     << "\n Worker processes : " << gOptNWorkers
      << "\n";
 
   LOG("gmkspl", pNOTICE) << *RunOpt::Instance();
@@ -351,6 +449,7 @@ void PrintSyntax(void)
     << " <-o | --output-cross-section> xsec_xml_file_name"
     << " [-n nknots] [-e max_energy] "
     << " [--seed seed_number]"
+    << " [--workers n]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
     << " [--xml-path config_xml_dir]"
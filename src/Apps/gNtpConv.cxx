@@ -9,6 +9,7 @@
          Syntax:
            gntpc -i input_file [-o output_file] -f format [-n nev] [-v vrs] [-c] 
                  [--seed random_number_seed]
+                 [--compression settings] [--basket-size bytes]
                  [--message-thresholds xml_file]
                  [--event-record-print-level level]
 
@@ -42,6 +43,13 @@
    	       * `rootracker_mock_data': 
                      As the `rootracker' format but hiddes all information
                      except the final state particles.
+   	       * `gcol': 
+                     Columnar GENIE event tree (see NtpMCColumns): each event
+                     and particle field is a flat (array) branch, so that
+                     any subset of columns can be read without deserializing
+                     the full event records.
+   	       * `ghep': 
+                     Converts a `gcol' file back to the native GHEP format.
               >>
 	      >> Experiment-specific formats:
               >>
@@ -83,6 +91,8 @@
                `ghep_mock_data'       -> *.mockd.ghep.root
                `rootracker'           -> *.gtrac.root
                `rootracker_mock_data' -> *.mockd.gtrac.root
+               `gcol'                 -> *.gcol.root
+               `ghep'                 -> *.ghep.root
                `t2k_rootracker'       -> *.gtrac.root
                `numi_rootracker'      -> *.gtrac.root
                `t2k_tracker'          -> *.gtrac.dat
@@ -91,6 +101,12 @@
                `ginuke'               -> *.ginuke.root
            --seed
               Random number seed.
+           --compression
+              ROOT compression settings (100 x algorithm + level) of the
+              `gcol' and `ghep' output files (default: ROOT default).
+           --basket-size
+              Basket size (bytes) of the `gcol' and `ghep' output branches
+              (default: 32000).
          --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -147,6 +163,7 @@
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCColumns.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Messenger/Messenger.h"
@@ -184,6 +201,8 @@ using namespace genie::constants;
 void   ConvertToGST              (void);
 void   ConvertToGXML             (void);
 void   ConvertToGHepMock         (void);
+void   ConvertToGCol             (void);
+void   ConvertFromGCol           (void);
 void   ConvertToGTracker         (void);
 void   ConvertToGRooTracker      (void);
 void   ConvertToGHad             (void);
@@ -207,7 +226,9 @@ typedef enum EGNtpcFmt {
   kConvFmt_t2k_tracker,
   kConvFmt_nuance_tracker,
   kConvFmt_ghad,
-  kConvFmt_ginuke
+  kConvFmt_ginuke,
+  kConvFmt_gcol,
+  kConvFmt_ghep
 } GNtpcFmt_t;
 
 //input options (from command line arguments):
@@ -218,6 +239,8 @@ int        gOptVersion;             ///< output file format version
 Long64_t   gOptN;                   ///< number of events to process
 bool       gOptCopyJobMeta = false; ///< copy MC job metadata (gconfig, genv TFolders)
 long int   gOptRanSeed;             ///< random number seed
+int        gOptCompression = -1;    ///< compression settings (gcol, ghep; <0: ROOT default)
+int        gOptBasketSize  = 32000; ///< basket size (gcol, ghep)
 
 //genie version used to generate the input event file 
 int gFileMajorVrs = -1;
@@ -280,6 +303,16 @@ int main(int argc, char ** argv)
 	ConvertToGINuke();         
 	break;
 
+   case (kConvFmt_gcol) :  
+
+	ConvertToGCol();         
+	break;
+
+   case (kConvFmt_ghep) :  
+
+	ConvertFromGCol();         
+	break;
+
    default:
      LOG("gntpc", pFATAL)
           << "Invalid output format [" << gOptOutFileFormat << "]";
@@ -1299,6 +1332,117 @@ void ConvertToGHepMock(void)
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
 }
 //____________________________________________________________________________________
+// GENIE GHEP FORMAT -> COLUMNAR GHEP FORMAT
+//____________________________________________________________________________________
+void ConvertToGCol(void)
+{
+  //-- open the ROOT file and get the TTree & its header
+  TFile fin(gOptInpFileName.c_str(),"READ");
+  TTree *           tree = 0;
+  NtpMCTreeHeader * thdr = 0;
+  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
+  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+
+  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
+
+  //-- get mc record
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+
+  //-- figure out how many events to analyze
+  Long64_t nmax = (gOptN<0) ?
+       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  if (nmax<0) {
+    LOG("gntpc", pERROR) << "Number of events = 0";
+    return;
+  }
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+
+  //-- initialize an Ntuple Writer
+  NtpWriter ntpw(kNFGCOL, thdr->runnu);
+  ntpw.CustomizeFilename(gOptOutFileName);
+  ntpw.SetCompressionSettings(gOptCompression);
+  ntpw.SetBasketSize(gOptBasketSize);
+  ntpw.Initialize();
+
+  //-- event loop
+  for(Long64_t iev = 0; iev < nmax; iev++) {
+    tree->GetEntry(iev);
+    LOG("gntpc", pINFO) << *(mcrec->event);
+
+    ntpw.AddEventRecord(mcrec->hdr.ievent, mcrec->event);
+
+    mcrec->Clear();
+  } // event loop
+
+  //-- save the converted MC events
+  ntpw.Save();
+
+  fin.Close();
+
+  LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+}
+//____________________________________________________________________________________
+// COLUMNAR GHEP FORMAT -> GENIE GHEP FORMAT
+//____________________________________________________________________________________
+void ConvertFromGCol(void)
+{
+  //-- open the ROOT file and get the TTree & its header
+  TFile fin(gOptInpFileName.c_str(),"READ");
+  TTree *           tree = 0;
+  NtpMCTreeHeader * thdr = 0;
+  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
+  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+
+  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
+
+  if(thdr->format != kNFGCOL) {
+    LOG("gntpc", pFATAL)
+      << "The input file is not in the columnar GHEP format";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  //-- get the columns
+  NtpMCColumns cols;
+  cols.SetBranchAddresses(tree);
+
+  //-- figure out how many events to analyze
+  Long64_t nmax = (gOptN<0) ?
+       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  if (nmax<0) {
+    LOG("gntpc", pERROR) << "Number of events = 0";
+    return;
+  }
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+
+  //-- initialize an Ntuple Writer
+  NtpWriter ntpw(kNFGHEP, thdr->runnu);
+  ntpw.CustomizeFilename(gOptOutFileName);
+  ntpw.SetCompressionSettings(gOptCompression);
+  ntpw.SetBasketSize(gOptBasketSize);
+  ntpw.Initialize();
+
+  //-- event loop
+  for(Long64_t iev = 0; iev < nmax; iev++) {
+    tree->GetEntry(iev);
+
+    EventRecord * event = cols.ToEventRecord();
+    LOG("gntpc", pINFO) << *event;
+
+    ntpw.AddEventRecord(cols.iev, event);
+
+    delete event;
+  } // event loop
+
+  //-- save the converted MC events
+  ntpw.Save();
+
+  fin.Close();
+
+  LOG("gntpc", pINFO) << "\nDone converting GENIE's columnar GHEP ntuple";
+}
+//____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> TRACKER FORMATS
 //____________________________________________________________________________________
 void ConvertToGTracker(void)
@@ -3010,6 +3154,8 @@ void GetCommandLineArgs(int argc, char ** argv)
     else if (fmt == "nuance_tracker" )       { gOptOutFileFormat = kConvFmt_nuance_tracker;        }
     else if (fmt == "ghad")                  { gOptOutFileFormat = kConvFmt_ghad;                  }
     else if (fmt == "ginuke")                { gOptOutFileFormat = kConvFmt_ginuke;                }
+    else if (fmt == "gcol")                  { gOptOutFileFormat = kConvFmt_gcol;                  }
+    else if (fmt == "ghep")                  { gOptOutFileFormat = kConvFmt_ghep;                  }
     else                                     { gOptOutFileFormat = kConvFmt_undef;                 }
 
     if(gOptOutFileFormat == kConvFmt_undef) {
@@ -3069,6 +3215,16 @@ void GetCommandLineArgs(int argc, char ** argv)
     LOG("gntpc", pINFO) << "Unspecified random number seed - Using default";
     gOptRanSeed = -1;
   }
+
+  // compression & basket size of the gcol / ghep output
+  if( parser.OptionExists("compression") ) {
+    LOG("gntpc", pINFO) << "Reading compression settings";
+    gOptCompression = parser.ArgAsInt("compression");
+  }
+  if( parser.OptionExists("basket-size") ) {
+    LOG("gntpc", pINFO) << "Reading basket size";
+    gOptBasketSize = parser.ArgAsInt("basket-size");
+  }
  
   LOG("gntpc", pNOTICE) << "Input filename  = " << gOptInpFileName;
   LOG("gntpc", pNOTICE) << "Output filename = " << gOptOutFileName;
@@ -3096,6 +3252,8 @@ string DefaultOutputFile(void)
   else if (gOptOutFileFormat == kConvFmt_nuance_tracker       ) { ext = "gtrac_legacy.dat"; }
   else if (gOptOutFileFormat == kConvFmt_ghad                 ) { ext = "ghad.dat";         }
   else if (gOptOutFileFormat == kConvFmt_ginuke               ) { ext = "ginuke.root";      }
+  else if (gOptOutFileFormat == kConvFmt_gcol                 ) { ext = "gcol.root";        }
+  else if (gOptOutFileFormat == kConvFmt_ghep                 ) { ext = "ghep.root";        }
 
   string inpname = gOptInpFileName;
   unsigned int L = inpname.length();
@@ -3112,6 +3270,12 @@ string DefaultOutputFile(void)
     inpname.erase(pos, pos+4);
   }
 
+  // remove gcol.
+  pos = inpname.find("gcol.");
+  if(pos != string::npos) {
+    inpname.erase(pos, 5);
+  }
+
   ostringstream name;
   name << inpname << ext;
 
@@ -3131,6 +3295,8 @@ int LatestFormatVersionNumber(void)
   else if (gOptOutFileFormat == kConvFmt_nuance_tracker       ) return 1;
   else if (gOptOutFileFormat == kConvFmt_ghad                 ) return 1;
   else if (gOptOutFileFormat == kConvFmt_ginuke               ) return 1;
+  else if (gOptOutFileFormat == kConvFmt_gcol                 ) return 1;
+  else if (gOptOutFileFormat == kConvFmt_ghep                 ) return 1;
 
   return -1;
 }
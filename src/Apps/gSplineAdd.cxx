@@ -7,7 +7,7 @@
 
          Syntax :
            gspladd -f file_list -d directory_list -o output.xml
-                   [--message-thresholds xml_file]
+                   [--binary] [--message-thresholds xml_file]
 
          Options :
            -f 
@@ -18,13 +18,22 @@
               files. If more than one then separate using commas.
            -o 
               output xml file
+           --binary
+              Write the output in the binary spline format instead of XML.
+              Binary files are memory-mapped and each spline is built only
+              when first used, which cuts the start-up time and memory of
+              jobs using a large spline file. They can be used wherever an
+              XML spline file is expected (e.g. the --cross-sections option).
+              The format depends on the machine byte order: Convert the XML
+              files at each site rather than distributing binary files.
            --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
               See $GENIE/config/Messenger.xml for the XML schema.
 
          Notes :
-           There must be at least 2 files for the merges to work
+           There must be at least 2 files for the merges to work, unless
+           the --binary option is used (for converting a single file)
 
          Examples :
 
@@ -39,6 +48,10 @@
               can be found in the /path and /other_path directories and write-out
               a single file named xsec_all.xml
 
+           3) shell% gspladd -f xsec.xml -o xsec.bin --binary
+
+              will convert xsec.xml to the binary format
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
          Rutherford Appleton Laboratory
 
@@ -82,6 +95,7 @@ string         gOutFile;   ///< output XML file
 vector<string> gInpFiles;  ///< list of input XML files
 vector<string> gInpDirs;   ///< list of input dirs (to look for XML files)
 vector<string> gAllFiles;  ///< list of all input files
+bool           gBinary;    ///< write the output in the binary format?
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -104,7 +118,8 @@ int main(int argc, char ** argv)
 
   LOG("gspladd", pNOTICE) 
      << " ****** Saving all loaded splines into : " << gOutFile;
-  xspl->SaveAsXml(gOutFile);
+  if(gBinary) xspl->SaveAsBinary(gOutFile);
+  else        xspl->SaveAsXml   (gOutFile);
 
   return 0;
 }
@@ -184,8 +199,10 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(1);
   }
 
+  gBinary = parser.OptionExists("binary");
+
   gAllFiles = GetAllInputFiles();
-  if(gAllFiles.size() <= 1) {
+  if(gAllFiles.size() < 1 || (gAllFiles.size() == 1 && !gBinary)) {
     LOG("gspladd", pFATAL) << "There must be at least 2 input files";
     PrintSyntax();
     exit(1);
@@ -197,7 +214,7 @@ void PrintSyntax(void)
   LOG("gspladd", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
     << "   gspladd  -f file_list -d directory_list  -o output.xml\n"
-    << "            [--message-thresholds xml_file]\n";
+    << "            [--binary] [--message-thresholds xml_file]\n";
 
 }
 //____________________________________________________________________________
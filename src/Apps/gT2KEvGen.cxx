@@ -24,6 +24,8 @@
                       [-t top_volume_name_at_geom || -t +Vol1-Vol2...]
                       [-P pre_gen_prob_file_name]
                       [-S] [output_name]
+                      [--update-flux-probs]
+                      [--flux-prob-workers n_of_processes]
                       [-m max_path_lengths_xml_file]
                       [-L length_units_at_geom]
                       [-D density_units_at_geom]
@@ -40,6 +42,7 @@
                       [--event-record-print-level level]
                       [--mc-job-status-refresh-rate  rate]
                       [--cache-file root_file]
+                      [--event-output-queue n]
 
          *** Options :
 
@@ -120,6 +123,20 @@
               Introducing multiple functionality to the executable is not
               desirable but is less error prone than duplicating a lot of the
               functionality in a separate application.
+           --update-flux-probs
+              Used with -S: if the output interaction probabilities file
+              already exists (from a job with the same flux & geometry, possibly
+              over fewer flux entries), reuse the probabilities stored for the
+              same flux entries and only calculate the missing ones. The file
+              is then rewritten with all of them.
+           --flux-prob-workers
+              Number of processes used to pre-calculate the flux interaction
+              probabilities (-S option).
+              The flux neutrinos are read once by the main process (and kept
+              in memory) before the others are started, they are interleaved
+              among the processes and the results are merged in flux entry
+              order, so the output is identical to the single process one
+              (see gtestFluxProbWorkers). [default: 1]
            -m
               An XML file (generated by gmxpl) with the max (density weighted)
               path-lengths for each target material in the input ROOT geometry.
@@ -319,6 +336,11 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --event-output-queue
+              Accepted for consistency with gevgen, but ignored: the flux
+              pass-through branches added to the output tree are filled from
+              buffers that the flux driver overwrites for the next neutrino,
+              so events are always written synchronously.
 
          *** Examples:
 
@@ -504,6 +526,8 @@ bool            gOptUseFluxProbs = false;      // use pre-calculated flux intera
 bool            gOptSaveFluxProbsFile = false; // special mode: no events generated, calculate and save flux interaction probs to root file
 string          gOptFluxProbFileName;          // filename for file containg flux probs
 string          gOptSaveFluxProbsFileName;     // output filename for pre-generated flux probabilities
+bool            gOptUpdateFluxProbsFile = false; // reuse the flux interaction probs already in the -S output file
+int             gOptNFluxProbWorkers = 1;      // number of processes pre-calculating the flux interaction probs
 bool            gOptRandomFluxOffset = false;  // start looping over flux file from random start entry
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
@@ -679,8 +703,9 @@ int main(int argc, char ** argv)
       // if specified override with cmd line option
       if(gOptSaveFluxProbsFileName.size()>0) name = gOptSaveFluxProbsFileName;
       // Tell the driver save pre-generated probabilities to an output file
-      mcj_driver->SaveFluxProbabilities(name);
+      mcj_driver->SaveFluxProbabilities(name, gOptUpdateFluxProbsFile);
     }
+    mcj_driver->SetPreCalcWorkers(gOptNFluxProbWorkers);
 
     // Either load pre-generated flux probabilities
     if(gOptFluxProbFileName.size() > 0){
@@ -1235,6 +1260,20 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptSaveFluxProbsFileName = parser.ArgAsString('S');
   }
 
+  // incrementally update the pre-generated interaction probs file
+  gOptUpdateFluxProbsFile = parser.OptionExists("update-flux-probs");
+
+  // number of processes pre-calculating the interaction probs
+  if( parser.OptionExists("flux-prob-workers") ){
+    gOptNFluxProbWorkers = parser.ArgAsInt("flux-prob-workers");
+    if(gOptNFluxProbWorkers < 1){
+      LOG("gevgen_t2k", pFATAL)
+       << "Invalid number of processes: " << gOptNFluxProbWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  }
+
   // cannot save and run at the same time
   if(gOptUseFluxProbs && gOptSaveFluxProbsFile){
     LOG("gevgen_t2k", pFATAL)
@@ -1472,6 +1511,8 @@ void PrintSyntax(void)
    << "\n           [-t top_volume_name_at_geom]"
    << "\n           [-P pre_gen_prob_file]"
    << "\n           [-S] [output_name]"
+   << "\n           [--update-flux-probs]"
+   << "\n           [--flux-prob-workers n_of_processes]"
    << "\n           [-m max_path_lengths_xml_file]"
    << "\n           [-L length_units_at_geom]"
    << "\n           [-D density_units_at_geom]"
@@ -1488,6 +1529,7 @@ void PrintSyntax(void)
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
    << "\n           [--cache-file root_file]"
+   << "\n           [--event-output-queue n]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << " or look at the source code: $GENIE/src/Apps/gT2KEvGen.cxx"
@@ -0,0 +1,121 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::fInstance = 0;
+//____________________________________________________________________________
+EventRecordPool::EventRecordPool() :
+fEnabled(RunOpt::Instance()->RecycleEventRecords()),
+fMaxSize(256)
+{
+  fInstance = 0;
+
+  pthread_mutex_init(&fMutex, 0);
+
+  LOG("EvRecPool", pINFO)
+    << "Recycling event records? " << ((fEnabled) ? "Yes" : "No");
+}
+//____________________________________________________________________________
+EventRecordPool::~EventRecordPool()
+{
+  this->Trim(0);
+
+  pthread_mutex_destroy(&fMutex);
+
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::Instance()
+{
+  if(fInstance == 0) {
+    static EventRecordPool::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EventRecordPool;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+EventRecord * EventRecordPool::Get(void)
+{
+  EventRecord * rec = 0;
+
+  if(fEnabled) {
+    pthread_mutex_lock(&fMutex);
+    if(!fFree.empty()) {
+      rec = fFree.back();
+      fFree.pop_back();
+    }
+    pthread_mutex_unlock(&fMutex);
+  }
+
+  if(!rec) rec = new EventRecord;
+
+  return rec;
+}
+//____________________________________________________________________________
+void EventRecordPool::Release(EventRecord * rec)
+{
+  if(!rec) return;
+
+  if(!fEnabled) {
+    delete rec;
+    return;
+  }
+
+  // reset outside the lock: the record is not shared
+  rec->ResetRecord();
+
+  pthread_mutex_lock(&fMutex);
+  bool keep = (fFree.size() < fMaxSize);
+  if(keep) fFree.push_back(rec);
+  pthread_mutex_unlock(&fMutex);
+
+  if(!keep) delete rec;
+}
+//____________________________________________________________________________
+void EventRecordPool::SetEnabled(bool on)
+{
+  fEnabled = on;
+
+  if(!fEnabled) this->Trim(0);
+}
+//____________________________________________________________________________
+void EventRecordPool::SetMaxSize(unsigned int n)
+{
+  fMaxSize = n;
+
+  this->Trim(n);
+}
+//____________________________________________________________________________
+unsigned int EventRecordPool::Size(void)
+{
+  pthread_mutex_lock(&fMutex);
+  unsigned int n = fFree.size();
+  pthread_mutex_unlock(&fMutex);
+
+  return n;
+}
+//____________________________________________________________________________
+void EventRecordPool::Trim(unsigned int n)
+{
+// Deletes free records until at most n are left
+
+  pthread_mutex_lock(&fMutex);
+  while(fFree.size() > n) {
+    delete fFree.back();
+    fFree.pop_back();
+  }
+  pthread_mutex_unlock(&fMutex);
+}
+//____________________________________________________________________________
@@ -0,0 +1,89 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EventRecordPool
+
+\brief    A pool of recycled event records.
+
+          In pooled mode (--recycle-event-records, or SetEnabled(true)) the
+          event generation drivers take their event records from the pool and
+          records released by their clients (e.g. by the NtpWriter, once an
+          event is written) are reset, keeping their particle slots, and
+          handed out again. In the steady state, no event record and no
+          GHepParticle is allocated for a new event.
+          Otherwise Get() and Release() simply create and delete records.
+
+          Get() and Release() may be called from different threads (records
+          are released by the NtpWriter I/O thread in asynchronous mode).
+
+\author   GENIE Collaboration
+
+\created  October 15, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_RECORD_POOL_H_
+#define _EVENT_RECORD_POOL_H_
+
+#include <vector>
+
+#include <pthread.h>
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class EventRecordPool
+{
+public:
+  static EventRecordPool * Instance(void);
+
+  //! get an empty event record (the caller takes ownership)
+  EventRecord * Get (void);
+
+  //! return an event record to the pool (the pool takes ownership)
+  void Release (EventRecord * rec);
+
+  //! enable / disable pooling & set the max number of records kept
+  void         SetEnabled (bool on);
+  void         SetMaxSize (unsigned int n);
+  bool         Enabled    (void) const { return fEnabled; }
+  unsigned int MaxSize    (void) const { return fMaxSize; }
+  unsigned int Size       (void);
+
+private:
+  EventRecordPool();
+  EventRecordPool(const EventRecordPool & pool);
+  virtual ~EventRecordPool();
+
+  void Trim (unsigned int n);
+
+  //! self
+  static EventRecordPool * fInstance;
+
+  bool                  fEnabled;  ///< recycle event records?
+  unsigned int          fMaxSize;  ///< max number of free records kept
+  vector<EventRecord *> fFree;     ///< free records
+  pthread_mutex_t       fMutex;    ///< guards fFree
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EventRecordPool::fInstance !=0) {
+            delete EventRecordPool::fInstance;
+            EventRecordPool::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVENT_RECORD_POOL_H_
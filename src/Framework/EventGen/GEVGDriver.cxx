@@ -21,6 +21,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/EventGeneratorList.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/ToyInteractionSelector.h"
@@ -309,7 +310,7 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
      } else {
        LOG("GEVGDriver", pWARN)
           << "The generated unphysical event is rejected";
-       delete fCurrentRecord;
+       EventRecordPool::Instance()->Release(fCurrentRecord);
        fCurrentRecord = 0;
        fNRecLevel++; // increase the nested level counter
 
@@ -379,50 +380,49 @@ double GEVGDriver::XSecSum(const TLorentzVector & nup4)
 
   double xsec_sum = 0;
 
-  // Get the list of spline objects
-  // Should have been constructed at the job initialization
-  XSecSplineList * xssl = XSecSplineList::Instance();
-
   // Get the list of all interactions that can be generated by this driver
   const InteractionList & ilst = fIntGenMap->GetInteractionList();
 
   // Loop over all interactions & compute cross sections
+  unsigned int iint = 0;
   InteractionList::const_iterator intliter;
-  for(intliter = ilst.begin(); intliter != ilst.end(); ++intliter) {
-
-     // get current interaction
-     Interaction * interaction = new Interaction(**intliter);
-     interaction->InitStatePtr()->SetProbeP4(nup4);
+  for(intliter = ilst.begin(); intliter != ilst.end(); ++intliter, ++iint) {
 
-     string code = interaction->AsString();
      SLOG("GEVGDriver", pDEBUG)
-             << "Compute cross section for interaction: \n" << code;
-
-     // get corresponding cross section algorithm
-     const XSecAlgorithmI * xsec_alg =
-               fIntGenMap->FindGenerator(interaction)->CrossSectionAlg();
-     assert(xsec_alg);
+             << "Compute cross section for interaction: \n"
+             << (*intliter)->AsString();
 
-     // compute (or evaluate) the cross section
+     // evaluate the cross section spline, resolved at UseSplines(),
+     // or compute the cross section
      double xsec = 0;
-     bool spline_exists = xssl->SplineExists(xsec_alg, interaction);
-     if (spline_exists && fUseSplines) {
+     const Spline * spl = (fUseSplines) ? fIntGenMap->XSecSpline(iint) : 0;
+     if (spl) {
         double E = nup4.Energy();
-        xsec = xssl->GetSpline(xsec_alg,interaction)->Evaluate(E);
-     } else
+        xsec = spl->Evaluate(E);
+     } else {
+        // get current interaction
+        Interaction * interaction = new Interaction(**intliter);
+        interaction->InitStatePtr()->SetProbeP4(nup4);
+
+        // get corresponding cross section algorithm
+        const XSecAlgorithmI * xsec_alg =
+               fIntGenMap->FindGenerator(interaction)->CrossSectionAlg();
+        assert(xsec_alg);
+
         xsec = xsec_alg->Integral(interaction);
+        delete interaction;
+     }
 
      xsec = TMath::Max(0., xsec);
 
      // sum-up and report
      xsec_sum += xsec;
      LOG("GEVGDriver", pDEBUG)
-            << "\nInteraction   = " << code
+            << "\nInteraction   = " << (*intliter)->AsString()
             << "\nCross Section "
             << (fUseSplines ? "*interpolated*" : "*computed*")
             << " = " << (xsec/units::cm2) << " cm2";
 
-     delete interaction;
   } // loop over event generators
 
   PDGLibrary * pdglib = PDGLibrary::Instance();
@@ -521,57 +521,14 @@ void GEVGDriver::UseSplines(void)
 //    splines it needs. If not, then its fiery personality will take over and
 //    it will refuse your request, reverting back to not using splines.
 
-  fUseSplines = true;
-
-  // Get the list of spline objects
-  // Should have been constructed at the job initialization
-  XSecSplineList * xsl = XSecSplineList::Instance();
+  // Make sure that all the splines needed have been computed or loaded and
+  // look them up once, so that they can be accessed directly during event
+  // generation
+  fUseSplines = fIntGenMap->ResolveXSecSplines();
 
-  // If the user wants to use splines, make sure that all the splines needed
-  // have been computed or loaded
-  if(fUseSplines) {
-
-    // Get the list of all interactions that can be generated by this driver
-    const InteractionList & ilst = fIntGenMap->GetInteractionList();
-
-    // Loop over all interactions & check that all splines have been loaded
-    InteractionList::const_iterator intliter;
-    for(intliter = ilst.begin(); intliter != ilst.end(); ++intliter) {
-
-       // current interaction
-       Interaction * interaction = *intliter;
-
-       // corresponding cross section algorithm
-       const XSecAlgorithmI * xsec_alg =
-                 fIntGenMap->FindGenerator(interaction)->CrossSectionAlg();
-       assert(xsec_alg);
-
-       // spline exists in spline list?
-       bool spl_exists = xsl->SplineExists(xsec_alg, interaction);
-
-       // update the 'use splines' flag
-       fUseSplines = fUseSplines && spl_exists;
-
-       if(!spl_exists) {
-          if(!xsec_alg) {
-            LOG("GEVGDriver", pWARN)
-              << "Null cross-section algorithm! Can not load cross-section spline.";
-            return;
-          }
-          if(!interaction) {
-            LOG("GEVGDriver", pWARN)
-              << "Null interaction! Can not load cross-section spline.";
-            return;
-          }
-          LOG("GEVGDriver", pWARN)
-             << "*** At least a spline (algorithm: "
-             << xsec_alg->Id().Key() << ", interaction: "
-             << interaction->AsString() << " doesn't exist. "
-             << "Reverting back to not using splines";
-          return;
-       }
-     } // loop over interaction list
-  }//use-splines?
+  if(!fUseSplines) {
+    LOG("GEVGDriver", pWARN) << "Reverting back to not using splines";
+  }
 }
 //___________________________________________________________________________
 void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
@@ -662,7 +619,15 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
 
   LOG("GEVGDriver", pINFO) << *xsl; // print list of splines
 
+  // When the spline creation is shared among worker processes, the splines
+  // built by the other workers are missing: do not look them up
+  if(xsl->NWorkers() > 1) {
+    fUseSplines = false;
+    return;
+  }
+
   fUseSplines = true;
+  if(fIntGenMap) fUseSplines = fIntGenMap->ResolveXSecSplines();
 }
 //___________________________________________________________________________
 Range1D_t GEVGDriver::ValidEnergyRange(void) const
@@ -62,6 +62,61 @@ GEVGDriver * GEVGPool::FindDriver(string init) const
   return driver;
 }
 //___________________________________________________________________________
+void GEVGPool::BuildIndex(
+               const vector<int> & nulist, const vector<int> & tgtlist)
+{
+// Tabulates the drivers for all (neutrino, target) pairs, in the order of
+// the input lists. Missing drivers are stored as null pointers.
+
+  fIdxNu  = nulist;
+  fIdxTgt = tgtlist;
+
+  int nnu  = fIdxNu.size();
+  int ntgt = fIdxTgt.size();
+
+  fIdxDrivers.assign(nnu*ntgt, (GEVGDriver*)0);
+
+  for(int inu = 0; inu < nnu; inu++) {
+    for(int itgt = 0; itgt < ntgt; itgt++) {
+      InitialState init_state(fIdxTgt[itgt], fIdxNu[inu]);
+      fIdxDrivers[inu*ntgt+itgt] = this->FindDriver(init_state);
+    }
+  }
+}
+//___________________________________________________________________________
+GEVGDriver * GEVGPool::Driver(int inu, int itgt) const
+{
+// Returns the driver for the input (neutrino, target) indices (see BuildIndex)
+// or a null pointer if the indices are out of range
+
+  int nnu  = fIdxNu.size();
+  int ntgt = fIdxTgt.size();
+  if(inu < 0 || inu >= nnu || itgt < 0 || itgt >= ntgt) {
+    LOG("GEVGPool", pERROR)
+      << "No indexed driver at (neutrino, target) index = ("
+      << inu << ", " << itgt << ")";
+    return 0;
+  }
+  return fIdxDrivers[inu*ntgt+itgt];
+}
+int GEVGPool::NuIndex(int nupdgc) const
+{
+  int nnu = fIdxNu.size();
+  for(int inu = 0; inu < nnu; inu++) {
+    if(fIdxNu[inu] == nupdgc) return inu;
+  }
+  return -1;
+}
+//___________________________________________________________________________
+int GEVGPool::TargetIndex(int tgtpdgc) const
+{
+  int ntgt = fIdxTgt.size();
+  for(int itgt = 0; itgt < ntgt; itgt++) {
+    if(fIdxTgt[itgt] == tgtpdgc) return itgt;
+  }
+  return -1;
+}
+//___________________________________________________________________________
 void GEVGPool::Print(ostream & stream) const
 {
   stream << "\n GEVGDriver List:" << endl;
@@ -5,6 +5,11 @@
 
 \brief   A pool of GEVGDriver objects with an initial state key
 
+         Once the pool is filled, BuildIndex() can be called with the lists of
+         neutrino and target codes so that drivers can also be retrieved by
+         (neutrino index, target index) without formatting / comparing the
+         initial state strings.
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -19,10 +24,12 @@
 #define _GEVG_DRIVER_POOL_H_
 
 #include <map>
+#include <vector>
 #include <string>
 #include <ostream>
 
 using std::map;
+using std::vector;
 using std::string;
 using std::ostream;
 
@@ -44,9 +51,20 @@ public :
   GEVGDriver * FindDriver (const InitialState & init) const;
   GEVGDriver * FindDriver (string init)               const;
 
+  void         BuildIndex  (const vector<int> & nulist, const vector<int> & tgtlist);
+  int          NuIndex     (int nupdgc)         const;
+  int          TargetIndex (int tgtpdgc)        const;
+  GEVGDriver * Driver      (int inu, int itgt)  const;
+
   void Print (ostream & stream) const;
 
   friend ostream & operator << (ostream & stream, const GEVGPool & pool);
+
+private:
+
+  vector<int>          fIdxNu;      ///< indexed neutrino codes
+  vector<int>          fIdxTgt;     ///< indexed target codes
+  vector<GEVGDriver *> fIdxDrivers; ///< drivers at [neutrino index * number of targets + target index]
 };
 
 }      // genie namespace
@@ -9,6 +9,9 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <algorithm>
+#include <iostream>
+#include <unistd.h>
 
 #include <TVector3.h>
 #include <TSystem.h>
@@ -33,6 +36,7 @@
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Conventions/Constants.h"
 
@@ -196,7 +200,10 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
 // relating flux index (entry number in input flux tree) to interaction
 // probability. If a pre-generated flux interaction probability tree has
 // already been loaded then just returns true. Also save tree to a TFile
-// for use in later jobs if flag is set
+// for use in later jobs if flag is set.
+// The flux entries can be shared among several processes (see
+// SetPreCalcWorkers()) and, when saving in incremental mode, probabilities
+// already in the output file are reused (see SaveFluxProbabilities()).
 //
   bool success = true;
 
@@ -215,8 +222,21 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
   // otherwise create them on the fly now
   else {
 
+    // In incremental mode, an existing output file is read while the new
+    // one is written next to it and moved into place when complete
+    string reuse_file = "";
+    string out_file   = fFluxIntFileName;
+    if(save_to_file && fFluxIntIncremental &&
+       !gSystem->AccessPathName(fFluxIntFileName.c_str())) {
+      reuse_file = fFluxIntFileName;
+      out_file   = fFluxIntFileName + ".update";
+      LOG("GMCJDriver", pNOTICE)
+         << "Reusing the flux interaction probabilities in: " << reuse_file;
+    }
+
     if(save_to_file){
-      fFluxIntProbFile = new TFile(fFluxIntFileName.c_str(), "CREATE");
+      fFluxIntProbFile = new TFile(out_file.c_str(),
+                            (reuse_file.size()>0) ? "RECREATE" : "CREATE");
       if(fFluxIntProbFile->IsZombie()){
         LOG("GMCJDriver", pFATAL) << "Cannot overwrite an existing file. Exiting!";
         exit(1);
@@ -224,13 +244,7 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
     }
 
     // Create the tree to store flux probs
-    fFluxIntTree = new TTree(fFluxIntTreeName.c_str(),
-                         "Tree storing pre-calculated flux interaction probs");
-    fFluxIntTree->Branch("FluxIndex", &fBrFluxIndex, "FluxIndex/I");
-    fFluxIntTree->Branch("FluxIntProb", &fBrFluxIntProb, "FluxIntProb/D");
-    fFluxIntTree->Branch("FluxEnu", &fBrFluxEnu, "FluxEnu/D");
-    fFluxIntTree->Branch("FluxWeight", &fBrFluxWeight, "FluxWeight/D");
-    fFluxIntTree->Branch("FluxPDG", &fBrFluxPDG, "FluxPDG/I");
+    fFluxIntTree = this->NewFluxProbTree();
     // Associate to file otherwise get std::bad_alloc when writing large trees
     if(save_to_file) fFluxIntTree->SetDirectory(fFluxIntProbFile);
 
@@ -241,42 +255,11 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
     // Loop over flux entries and calculate interaction probabilities
     TStopwatch stopwatch;
     stopwatch.Start();
-    long int first_index = -1;
-    bool first_loop = true;
-    // loop until at end of flux ntuple
-    while(fFluxDriver->End() == false){
-
-      // get the next flux neutrino
-      bool gotnext = fFluxDriver->GenerateNext();
-      if(!gotnext){
-        LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
-        continue;
-      }
-
-      // stop if completed a full cycle (this check is necessary as fluxdriver
-      // may be set to loop over more than one cycle before reaching end)
-      bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
-      if(already_been_here) break;
-
-      // compute the path lengths for current flux neutrino
-      if(this->ComputePathLengths() == false){ success = false; break;}
-
-      // compute and store the interaction probability
-      double psum = this->ComputeInteractionProbabilities(false /*Based on actual PLs*/);
-      assert(psum+controls::kASmallNum > 0.);
-      fBrFluxIntProb = psum;
-      fBrFluxIndex   = fFluxDriver->Index();
-      fBrFluxEnu     = fFluxDriver->Momentum().E();
-      fBrFluxWeight  = fFluxDriver->Weight();
-      fBrFluxPDG     = fFluxDriver->PdgCode();
-      fFluxIntTree->Fill();
-
-      // store the first index so know when have cycled exactly once
-      if(first_loop){
-        first_index = fFluxDriver->Index();
-        first_loop = false;
-      }
-    } // flux loop
+    if(fNPreCalcWorkers > 1) {
+      success = this->PreCalcFluxProbabilitiesMP(reuse_file);
+    } else {
+      success = this->FillFluxProbTree(fFluxIntTree, reuse_file);
+    }
     stopwatch.Stop();
     LOG("GMCJDriver", pNOTICE)
                     << "Finished pre-calculating flux interaction probabilities. "
@@ -315,6 +298,14 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
           fFluxIntProbFile->GetName();
       fFluxIntProbFile->cd();
       fFluxIntTree->Write();
+      // in incremental mode, replace the file the probabilities were read from
+      string out_file = fFluxIntProbFile->GetName();
+      if(out_file != fFluxIntFileName) {
+        if(gSystem->Rename(out_file.c_str(), fFluxIntFileName.c_str()) != 0) {
+          LOG("GMCJDriver", pERROR)
+            << "Could not move " << out_file << " to " << fFluxIntFileName;
+        }
+      }
     }
 
     // Also build index for use later
@@ -340,6 +331,302 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
   return success;
 }
 //___________________________________________________________________________
+TTree * GMCJDriver::NewFluxProbTree(void)
+{
+  TTree * tree = new TTree(fFluxIntTreeName.c_str(),
+                         "Tree storing pre-calculated flux interaction probs");
+  tree->Branch("FluxIndex", &fBrFluxIndex, "FluxIndex/I");
+  tree->Branch("FluxIntProb", &fBrFluxIntProb, "FluxIntProb/D");
+  tree->Branch("FluxEnu", &fBrFluxEnu, "FluxEnu/D");
+  tree->Branch("FluxWeight", &fBrFluxWeight, "FluxWeight/D");
+  tree->Branch("FluxPDG", &fBrFluxPDG, "FluxPDG/I");
+  return tree;
+}
+//___________________________________________________________________________
+TTree * GMCJDriver::OpenFluxProbReuseTree(string reuse_file, TFile *& file)
+{
+// Opens the previously calculated probabilities (here, as each worker
+// process needs its own file handle). Returns 0 if they can not be used.
+
+  file = 0;
+  if(reuse_file.size()==0) return 0;
+
+  TTree * prev_tree = 0;
+  file = new TFile(reuse_file.c_str(), "READ");
+  if(!file->IsZombie()) {
+    prev_tree = dynamic_cast<TTree*>(file->Get(fFluxIntTreeName.c_str()));
+  }
+  bool ok = prev_tree &&
+      prev_tree->SetBranchAddress("FluxIntProb", &fBrFluxIntProb) >= 0 &&
+      prev_tree->SetBranchAddress("FluxIndex", &fBrFluxIndex) >= 0 &&
+      prev_tree->SetBranchAddress("FluxPDG", &fBrFluxPDG) >= 0 &&
+      prev_tree->SetBranchAddress("FluxWeight", &fBrFluxWeight) >= 0 &&
+      prev_tree->SetBranchAddress("FluxEnu", &fBrFluxEnu) >= 0 &&
+      prev_tree->BuildIndex("FluxIndex") == prev_tree->GetEntries();
+  if(!ok) {
+    LOG("GMCJDriver", pWARN)
+       << "Cannot use the flux interaction probabilities in: " << reuse_file
+       << " - Recalculating all of them";
+    prev_tree = 0;
+  }
+  return prev_tree;
+}
+//___________________________________________________________________________
+bool GMCJDriver::FillFluxProbEntry(
+      TTree * tree, TTree * prev_tree, const FluxRay & ray, bool & reused)
+{
+// Fills the input tree with the interaction probability of the input flux
+// neutrino. A probability found in the prev_tree (for the same flux index,
+// neutrino code & energy) is not recomputed.
+
+  double enu = ray.p4[3];
+
+  // reuse the previously calculated probability, if any
+  reused = false;
+  if(prev_tree && prev_tree->GetEntryWithIndex(ray.index) > 0) {
+    reused = (fBrFluxPDG == ray.pdg &&
+              TMath::Abs(fBrFluxEnu - enu) < controls::kASmallNum);
+  }
+  double psum = fBrFluxIntProb;
+  if(!reused) {
+    TLorentzVector nup4(ray.p4[0], ray.p4[1], ray.p4[2], ray.p4[3]);
+    TLorentzVector nux4(ray.x4[0], ray.x4[1], ray.x4[2], ray.x4[3]);
+
+    // compute the path lengths for current flux neutrino
+    if(this->ComputePathLengths(nux4, nup4) == false) return false;
+
+    // compute and store the interaction probability
+    psum = this->ComputeInteractionProbabilities(
+                    ray.pdg, nup4, false /*Based on actual PLs*/);
+  }
+  assert(psum+controls::kASmallNum > 0.);
+  fBrFluxIntProb = psum;
+  fBrFluxIndex   = ray.index;
+  fBrFluxEnu     = enu;
+  fBrFluxWeight  = ray.weight;
+  fBrFluxPDG     = ray.pdg;
+  tree->Fill();
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::CurrentFluxRay(FluxRay & ray) const
+{
+// Records the flux neutrino last generated by the flux driver
+
+  const TLorentzVector & p4 = fFluxDriver->Momentum();
+  const TLorentzVector & x4 = fFluxDriver->Position();
+  ray.index  = fFluxDriver->Index();
+  ray.pdg    = fFluxDriver->PdgCode();
+  ray.weight = fFluxDriver->Weight();
+  for(int i = 0; i < 4; i++) { ray.p4[i] = p4[i]; ray.x4[i] = x4[i]; }
+}
+//___________________________________________________________________________
+bool GMCJDriver::FillFluxProbTree(TTree * tree, string reuse_file)
+{
+// Loops over a full cycle of flux entries and fills the input tree with
+// their interaction probabilities (see FillFluxProbEntry())
+
+  TFile * prev_file = 0;
+  TTree * prev_tree = this->OpenFluxProbReuseTree(reuse_file, prev_file);
+
+  bool success = true;
+  long int first_index = -1;
+  bool first_loop = true;
+  long int nreused = 0;
+  FluxRay ray;
+  // loop until at end of flux ntuple
+  while(fFluxDriver->End() == false){
+
+    // get the next flux neutrino
+    bool gotnext = fFluxDriver->GenerateNext();
+    if(!gotnext){
+      LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
+      continue;
+    }
+
+    // stop if completed a full cycle (this check is necessary as fluxdriver
+    // may be set to loop over more than one cycle before reaching end)
+    bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
+    if(already_been_here) break;
+
+    // store the first index so know when have cycled exactly once
+    if(first_loop){
+      first_index = fFluxDriver->Index();
+      first_loop = false;
+    }
+
+    this->CurrentFluxRay(ray);
+    bool reused = false;
+    if(!this->FillFluxProbEntry(tree, prev_tree, ray, reused)) {
+      success = false;
+      break;
+    }
+    if(reused) nreused++;
+  } // flux loop
+
+  if(prev_file) {
+    LOG("GMCJDriver", pNOTICE)
+       << "Reused " << nreused << " of " << tree->GetEntries()
+       << " flux interaction probabilities";
+    prev_file->Close();
+    delete prev_file;
+  }
+  return success;
+}
+//___________________________________________________________________________
+bool GMCJDriver::ReadFluxRays(vector<FluxRay> & rays)
+{
+// Records a full cycle of flux neutrinos, in the order the flux driver
+// generates them
+
+  rays.clear();
+
+  long int first_index = -1;
+  bool first_loop = true;
+  FluxRay ray;
+  while(fFluxDriver->End() == false){
+    bool gotnext = fFluxDriver->GenerateNext();
+    if(!gotnext){
+      LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
+      continue;
+    }
+    bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
+    if(already_been_here) break;
+    if(first_loop){
+      first_index = fFluxDriver->Index();
+      first_loop = false;
+    }
+    this->CurrentFluxRay(ray);
+    rays.push_back(ray);
+  }
+  return rays.size() > 0;
+}
+//___________________________________________________________________________
+bool GMCJDriver::FillFluxProbTree(
+      TTree * tree, const vector<FluxRay> & rays,
+      int iworker, int nworkers, string reuse_file)
+{
+// Fills the input tree with the interaction probabilities of every
+// nworkers-th recorded flux neutrino, starting at iworker
+
+  TFile * prev_file = 0;
+  TTree * prev_tree = this->OpenFluxProbReuseTree(reuse_file, prev_file);
+
+  bool success = true;
+  long int nreused = 0;
+  for(unsigned int i = iworker; i < rays.size(); i += nworkers) {
+    bool reused = false;
+    if(!this->FillFluxProbEntry(tree, prev_tree, rays[i], reused)) {
+      success = false;
+      break;
+    }
+    if(reused) nreused++;
+  }
+
+  if(prev_file) {
+    LOG("GMCJDriver", pNOTICE)
+       << "Reused " << nreused << " of " << tree->GetEntries()
+       << " flux interaction probabilities";
+    prev_file->Close();
+    delete prev_file;
+  }
+  return success;
+}
+//___________________________________________________________________________
+bool GMCJDriver::PreCalcFluxProbabilitiesMP(string reuse_file)
+{
+// Shares the flux entries among fNPreCalcWorkers processes. The parent
+// process reads a full cycle of flux neutrinos before forking: the workers
+// never touch the flux driver, whose open files share their offsets with
+// the parent after the fork. Worker k handles the k-th, (k+n)-th, (k+2n)-th,
+// ... flux neutrinos with its own copy of the geometry navigator and writes
+// them into its own file. The parent process then merges them into
+// fFluxIntTree in flux entry order, so that the tree is identical to the
+// one filled by a single process. The flux neutrinos are kept in memory
+// (~90 bytes each) during the pre-calculation.
+
+  int nworkers = fNPreCalcWorkers;
+
+  vector<FluxRay> rays;
+  if(!this->ReadFluxRays(rays)) {
+    LOG("GMCJDriver", pERROR) << "No flux neutrinos were generated";
+    return false;
+  }
+
+  string base = (fFluxIntFileName.size()>0) ? fFluxIntFileName :
+     Form("%s.%d.root", fFluxIntTreeName.c_str(), gSystem->GetPid());
+  vector<string> part_files(nworkers);
+  for(int iw = 0; iw < nworkers; iw++) {
+    part_files[iw] = Form("%s.worker%d", base.c_str(), iw);
+  }
+
+  LOG("GMCJDriver", pNOTICE)
+     << "Pre-calculating " << rays.size() << " flux interaction probabilities"
+     << " with " << nworkers << " processes";
+
+  vector<int> pids;
+  int iworker = utils::system::ForkWorkers(nworkers, pids);
+
+  // each process fills its share of the flux entries into its own file
+  TFile * part_file = new TFile(part_files[iworker].c_str(), "RECREATE");
+  TTree * part_tree = this->NewFluxProbTree();
+  part_tree->SetDirectory(part_file);
+  bool success = this->FillFluxProbTree(
+                        part_tree, rays, iworker, nworkers, reuse_file);
+  part_file->cd();
+  part_tree->Write();
+  part_file->Close();
+  delete part_file;
+
+  // workers are done (skip the exit handlers, as the files opened by the
+  // parent before forking are not theirs to close)
+  if(iworker > 0) {
+    std::cout.flush();
+    std::cerr.flush();
+    _exit(success ? 0 : 1);
+  }
+
+  success = utils::system::WaitForWorkers(pids) && success;
+
+  // merge, in flux entry order
+  vector<TFile *> files(nworkers, (TFile*)0);
+  vector<TTree *> trees(nworkers, (TTree*)0);
+  long int nentries = 0;
+  for(int iw = 0; iw < nworkers && success; iw++) {
+    files[iw] = new TFile(part_files[iw].c_str(), "READ");
+    trees[iw] = dynamic_cast<TTree*>(files[iw]->Get(fFluxIntTreeName.c_str()));
+    if(!trees[iw]) {
+      LOG("GMCJDriver", pERROR)
+        << "Cannot find the flux interaction probabilities of worker " << iw;
+      success = false;
+      break;
+    }
+    trees[iw]->SetBranchAddress("FluxIntProb", &fBrFluxIntProb);
+    trees[iw]->SetBranchAddress("FluxIndex", &fBrFluxIndex);
+    trees[iw]->SetBranchAddress("FluxPDG", &fBrFluxPDG);
+    trees[iw]->SetBranchAddress("FluxWeight", &fBrFluxWeight);
+    trees[iw]->SetBranchAddress("FluxEnu", &fBrFluxEnu);
+    nentries += trees[iw]->GetEntries();
+  }
+  for(long int ientry = 0; ientry < nentries && success; ientry++) {
+    TTree * tree = trees[ientry % nworkers];
+    long int  ie = ientry / nworkers;
+    if(ie >= tree->GetEntries()) {
+      LOG("GMCJDriver", pERROR)
+        << "Inconsistent flux entries among workers at entry " << ientry;
+      success = false;
+      break;
+    }
+    tree->GetEntry(ie);
+    fFluxIntTree->Fill();
+  }
+  for(int iw = 0; iw < nworkers; iw++) {
+    if(files[iw]) { files[iw]->Close(); delete files[iw]; }
+    gSystem->Unlink(part_files[iw].c_str());
+  }
+  return success;
+}
+//___________________________________________________________________________
 bool GMCJDriver::LoadFluxProbabilities(string filename)
 {
 // Load a pre-generated set of flux interaction probabilities from an external
@@ -387,13 +674,28 @@ bool GMCJDriver::LoadFluxProbabilities(string filename)
   return false;
 }
 //___________________________________________________________________________
-void GMCJDriver::SaveFluxProbabilities(string outfilename)
+void GMCJDriver::SaveFluxProbabilities(string outfilename, bool incremental)
 {
 // Configue the flux driver to save the calculated flux interaction
 // probabilities to the specified output file name for use in later jobs. See
 // the LoadFluxProbTree method for how they are fed into a later job.
+// In incremental mode the output file may already exist (from a job with
+// the same flux & geometry, possibly over fewer flux entries): the stored
+// probabilities are reused for matching flux entries (same index, neutrino
+// code and energy) and the file is rewritten with all of them.
+//
+  fFluxIntFileName    = outfilename;
+  fFluxIntIncremental = incremental;
+}
+//___________________________________________________________________________
+void GMCJDriver::SetPreCalcWorkers(int nworkers)
+{
+// Sets the number of processes used for pre-calculating the flux interaction
+// probabilities (see PreCalcFluxProbabilities()). They are forked (after
+// Configure(), so that splines & geometry are shared copy-on-write) for the
+// pre-calculation only.
 //
-  fFluxIntFileName = outfilename;
+  fNPreCalcWorkers = TMath::Max(1, nworkers);
 }
 //___________________________________________________________________________
 void GMCJDriver::Configure(bool calc_prob_scales)
@@ -442,6 +744,11 @@ void GMCJDriver::Configure(bool calc_prob_scales)
     this->ComputeProbScales();
   }
   if (fForceInteraction) fGlobPmax = 1.;
+
+  // Tabulate everything needed for computing the interaction probabilities
+  // of each flux neutrino (most of which are rejected) per (neutrino, target)
+  this->BuildProbTables();
+
   LOG("GMCJDriver", pNOTICE) << "Finished configuring GMCJDriver\n\n";
 }
 //___________________________________________________________________________
@@ -476,12 +783,16 @@ void GMCJDriver::InitJob(void)
   fPreSelect          = true;  // <-- default to use pre-selection based on maximum path lengths
 
   fSelTgtPdg          = 0;
+  fSelTgtIdx          = -1;
+  fCurNuIdx           = -1;
   fCurEvt             = 0;
   fCurVtx.SetXYZT(0.,0.,0.,0.);
 
   fFluxIntProbFile    = 0;
   fFluxIntTreeName    = "gFlxIntProb";
   fFluxIntFileName    = "";
+  fFluxIntIncremental = false;
+  fNPreCalcWorkers    = 1;
   fFluxIntTree        = 0;
   fBrFluxIntProb      = -1.;
   fBrFluxIndex        = -1;
@@ -490,6 +801,10 @@ void GMCJDriver::InitJob(void)
   fBrFluxPDG          = 0;
   fSumFluxIntProbs.clear();
 
+  fNWorkers           = 1;     // <-- single process job, unless ForkWorkers() is called
+  fWorkerId           = 0;
+  fWorkerPids.clear();
+
   // Throw as many flux neutrinos as necessary till one has interacted
   // so that GenerateEvent() never  returns NULL (except when in error)
   this->KeepOnThrowingFluxNeutrinos(true);
@@ -594,6 +909,12 @@ void GMCJDriver::PopulateEventGenDriverPool(void)
    } // targets
   } // neutrinos
 
+  // index the drivers by (neutrino, target), with the targets ordered as in
+  // the PathLengthList (increasing PDG code) and the neutrinos as in fNuList
+  fProbTgtPdg.assign(fTgtList.begin(), fTgtList.end());
+  std::sort(fProbTgtPdg.begin(), fProbTgtPdg.end());
+  fGPool->BuildIndex(fNuList, fProbTgtPdg);
+
   LOG("GMCJDriver", pNOTICE)
              << "All necessary GEVGDriver object were pushed into GEVGPool\n";
 }
@@ -712,63 +1033,62 @@ void GMCJDriver::ComputeProbScales(void)
     for(int i=0; i<=fPmaxNbins; i++) ebins[i] = emin + i * (emax-emin)/fPmaxNbins;
   }
 
-  PDGCodeList::const_iterator nuiter;
-  PDGCodeList::const_iterator tgtiter;
+  // the interaction probability is proportional to the cross section:
+  // get the probability per unit cross section at the max path length.
+  // The max of the cross section in each bin is exact (see below): the
+  // safety factor only covers the max path lengths, which are estimated
+  int ntgt = fProbTgtPdg.size();
+  vector<double> prob_per_xsec(ntgt);
+  for(int itgt = 0; itgt < ntgt; itgt++) {
+    int    target_pdgc = fProbTgtPdg[itgt];
+    double plmax = fPmaxSafetyFactor * fMaxPathLengths.PathLength(target_pdgc);
+    int    A     = pdg::IonPdgCodeToA(target_pdgc);
+    prob_per_xsec[itgt] = this->InteractionProbability(1., plmax, A);
+  }
+  vector<const Spline *> xsec_spl(ntgt);
 
   // loop over all neutrino types generated by the flux driver
+  PDGCodeList::const_iterator nuiter;
   for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
     int neutrino_pdgc = *nuiter;
+    int inu = fGPool->NuIndex(neutrino_pdgc);
+    for(int itgt = 0; itgt < ntgt; itgt++) {
+      GEVGDriver * evgdriver = fGPool->Driver(inu, itgt);
+      if(!evgdriver) {
+        LOG("GMCJDriver", pFATAL)
+         << "\n * The MC Job driver isn't properly configured!"
+         << "\n * No event generation driver could be found for init state: "
+         << InitialState(fProbTgtPdg[itgt], neutrino_pdgc).AsString();
+        exit(1);
+      }
+      xsec_spl[itgt] = evgdriver->XSecSumSpline();
+    }
+
     TH1D * pmax_hst = new TH1D("pmax_hst",
              "max interaction probability vs E | geom",fPmaxNbins,ebins);
     pmax_hst->SetDirectory(0);
 
     // loop over energy bins
     for(int ie = 1; ie <= pmax_hst->GetNbinsX(); ie++) {
-      double EvLow  = pmax_hst->GetBinCenter(ie) - 0.5*pmax_hst->GetBinWidth(ie);
-      double EvHigh = pmax_hst->GetBinCenter(ie) + 0.5*pmax_hst->GetBinWidth(ie);
-      //double Ev = pmax_hst->GetBinCenter(ie);
-
-       // loop over targets in input geometry, form initial state and compute
-       // the sum of maximum interaction probabilities at the current energy bin
-       //
-       for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
-         int target_pdgc = *tgtiter;
-
-         InitialState init_state(target_pdgc, neutrino_pdgc);
-
-         LOG("GMCJDriver", pDEBUG)
-           << "Computing Pmax for init-state: " << init_state.AsString() << " E from " << EvLow << "-" << EvHigh;
-
-         // get the appropriate driver
-         GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
-
-         // get xsec sum over all modelled processes for given neutrino+target)
-         double sxsecLow  = evgdriver->XSecSumSpline()->Evaluate(EvLow);
-	 double sxsecHigh = evgdriver->XSecSumSpline()->Evaluate(EvHigh);
-
-         // get max{path-length x density}
-         double plmax = fMaxPathLengths.PathLength(target_pdgc);
-
-         // compute/store the max interaction probabiity (for given energy)
-         int A = pdg::IonPdgCodeToA(target_pdgc);
-         double pmaxLow  = this->InteractionProbability(sxsecLow, plmax, A);
-         double pmaxHigh = this->InteractionProbability(sxsecHigh, plmax, A);
-
-	 double pmax = pmaxHigh;
-	 if ( pmaxLow > pmaxHigh){
-	   pmax = pmaxLow;
-	   LOG("GMCJDriver", pWARN)
-	     << "Lower energy neutrinos have a higher probability of interacting than those at higher energy."
-	     << " pmaxLow(E=" << EvLow << ")=" << pmaxLow << " and " << " pmaxHigh(E=" << EvHigh << ")=" << pmaxHigh;
-	 }
-
-         pmax_hst->SetBinContent(ie, pmax_hst->GetBinContent(ie) + pmax);
+      double EvLow  = pmax_hst->GetXaxis()->GetBinLowEdge(ie);
+      double EvHigh = pmax_hst->GetXaxis()->GetBinUpEdge(ie);
+
+       // sum over the targets in input geometry of the maximum interaction
+       // probability in the current energy bin: the max of the total xsec
+       // spline is found exactly from its polynomial pieces (rather than
+       // sampled at the bin edges)
+       double pmax = 0;
+       for(int itgt = 0; itgt < ntgt; itgt++) {
+         double sxsec = xsec_spl[itgt]->Max(EvLow, EvHigh);
+         pmax += prob_per_xsec[itgt] * sxsec;
 
          LOG("GMCJDriver", pDEBUG)
-           << "Pmax[" << init_state.AsString() << ", Ev from " << EvLow << "-" << EvHigh << "] = " << pmax;
+           << "Pmax[" << InitialState(fProbTgtPdg[itgt], neutrino_pdgc).AsString()
+           << ", Ev from " << EvLow << "-" << EvHigh << "] = "
+           << prob_per_xsec[itgt] * sxsec;
        } // targets
 
-       pmax_hst->SetBinContent(ie, fPmaxSafetyFactor * pmax_hst->GetBinContent(ie));
+       pmax_hst->SetBinContent(ie, pmax);
 
        LOG("GMCJDriver", pINFO)
 	 << "Pmax[nu=" << neutrino_pdgc << ", Ev from " << EvLow << "-" << EvHigh << "] = "
@@ -778,7 +1098,7 @@ void GMCJDriver::ComputeProbScales(void)
     fPmax.insert(map<int,TH1D*>::value_type(neutrino_pdgc,pmax_hst));
   } // nu
 
-  delete ebins;
+  delete [] ebins;
 
   // Compute global probability scale
   // Sum Probabilities {
@@ -801,11 +1121,97 @@ void GMCJDriver::ComputeProbScales(void)
   }
 }
 //___________________________________________________________________________
+void GMCJDriver::BuildProbTables(void)
+{
+// Looks up, once, the GEVGDriver total cross section splines, the target
+// mass numbers & max path lengths and the probability scales used for each
+// flux neutrino, so that computing the interaction probabilities takes a
+// loop over flat arrays rather than a GEVGPool (string-keyed) look-up and
+// a few map look-ups per target. The targets & neutrinos are indexed as in
+// the GEVGPool index (see PopulateEventGenDriverPool()).
+
+  int nnu  = fNuList.size();
+  int ntgt = fProbTgtPdg.size();
+
+  fProbTgtA    .resize(ntgt);
+  fProbMaxPl   .resize(ntgt);
+  fCurPl       .assign(ntgt, 0.);
+  fProbXSecSpl .resize(nnu*ntgt);
+  fCurCumulProb.resize(ntgt);
+
+  for(int itgt = 0; itgt < ntgt; itgt++) {
+    fProbTgtA[itgt] = pdg::IonPdgCodeToA(fProbTgtPdg[itgt]);
+  }
+  fMaxPathLengths.PathLengths(fProbTgtPdg, fProbMaxPl);
+
+  for(int inu = 0; inu < nnu; inu++) {
+    int neutrino_pdgc = fNuList[inu];
+    for(int itgt = 0; itgt < ntgt; itgt++) {
+      GEVGDriver * evgdriver = fGPool->Driver(inu, itgt);
+      if(!evgdriver) {
+        LOG("GMCJDriver", pFATAL)
+         << "\n * The MC Job driver isn't properly configured!"
+         << "\n * No event generation driver could be found for init state: "
+         << InitialState(fProbTgtPdg[itgt], neutrino_pdgc).AsString();
+        exit(1);
+      }
+      fProbXSecSpl[inu*ntgt+itgt] = evgdriver->XSecSumSpline();
+    }
+  }
+
+  // the probability scales (all neutrinos share the same energy bins)
+  fProbPmaxEdges.clear();
+  fProbPmax.clear();
+  if(fPmax.size() == 0) return;
+
+  const TAxis * axis = fPmax.begin()->second->GetXaxis();
+  int nbins = axis->GetNbins();
+  fProbPmaxEdges.resize(nbins+1);
+  for(int ib = 1; ib <= nbins+1; ib++) {
+    fProbPmaxEdges[ib-1] = axis->GetBinLowEdge(ib);
+  }
+  fProbPmax.assign(nnu*(nbins+2), 0.);
+  for(int inu = 0; inu < nnu; inu++) {
+    map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(fNuList[inu]);
+    if(pmax_iter == fPmax.end()) continue;
+    TH1D * pmax_hst = pmax_iter->second;
+    for(int ib = 0; ib <= nbins+1; ib++) {
+      fProbPmax[inu*(nbins+2)+ib] = pmax_hst->GetBinContent(ib);
+    }
+  }
+}
+//___________________________________________________________________________
+int GMCJDriver::PmaxBin(double Ev) const
+{
+// Returns the probability scale bin for the input energy, as TH1::FindBin()
+// would (0: underflow, nbins+1: overflow). The bins are uniform in E or in
+// log(E), so the bin is computed and then corrected for rounding at the
+// edges.
+
+  int nbins = fProbPmaxEdges.size() - 1;
+  double emin = fProbPmaxEdges[0];
+  double emax = fProbPmaxEdges[nbins];
+  if(Ev <  emin) return 0;
+  if(Ev >= emax) return nbins+1;
+
+  double u = (fPmaxLogBinning) ?
+     TMath::Log(Ev/emin)/TMath::Log(emax/emin) : (Ev-emin)/(emax-emin);
+  int ib = 1 + (int) (u*nbins);
+  if(ib < 1)     ib = 1;
+  if(ib > nbins) ib = nbins;
+  while(ib > 1     && Ev <  fProbPmaxEdges[ib-1]) ib--;
+  while(ib < nbins && Ev >= fProbPmaxEdges[ib]  ) ib++;
+  return ib;
+}
+//___________________________________________________________________________
 void GMCJDriver::InitEventGeneration(void)
 {
   fCurPathLengths.clear();
   fCurEvt    = 0;
   fSelTgtPdg = 0;
+  fSelTgtIdx = -1;
+  fCurNuIdx  = -1;
+  fCurPl.assign(fProbTgtPdg.size(), 0.);
   fCurVtx.SetXYZT(0.,0.,0.,0.);
 }
 //___________________________________________________________________________
@@ -838,6 +1244,61 @@ EventRecord * GMCJDriver::GenerateEvent(void)
   return 0;
 }
 //___________________________________________________________________________
+EventRecord * GMCJDriver::GenerateEvent(long int ievent)
+{
+  RandomGen::Instance()->SetEventSeed(ievent);
+
+  return this->GenerateEvent();
+}
+//___________________________________________________________________________
+int GMCJDriver::ForkWorkers(int nworkers)
+{
+// Splits the job into `nworkers' processes. Must be called after Configure()
+// so that the (expensive) job initialization is done only once and all its
+// products are shared, copy-on-write, by the worker processes.
+// The calling process becomes worker 0 and the method returns the index of
+// the worker in each process. Worker k is responsible for the event indices
+// k, k+nworkers, k+2*nworkers, ... (see IsWorkerEvent()) and, if events are
+// generated via GenerateEvent(ievent), the job output does not depend on the
+// number of workers.
+// Notes:
+// - Each worker owns a private copy of the flux driver. Flux drivers reading
+//   ntuples sequentially will therefore read the same entries in every
+//   worker; use histogram-based flux drivers or give each worker its own
+//   flux input if that is not desired.
+// - Each worker must write its own output (see the gevgen_fnal --workers
+//   option), and the parent must call WaitForWorkers() before exiting.
+
+  if(fNWorkers > 1) {
+    LOG("GMCJDriver", pERROR) << "Worker processes were already forked!";
+    return fWorkerId;
+  }
+  if(nworkers <= 1) return 0;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Forking " << nworkers-1 << " event generation worker processes";
+
+  fNWorkers = nworkers;
+  fWorkerId = utils::system::ForkWorkers(nworkers, fWorkerPids);
+
+  return fWorkerId;
+}
+//___________________________________________________________________________
+bool GMCJDriver::WaitForWorkers(void)
+{
+// Called by the parent process: Waits for all forked workers to finish and
+// returns true if all of them exited normally. A no-op in worker processes.
+
+  bool ok = utils::system::WaitForWorkers(fWorkerPids);
+  fWorkerPids.clear();
+  return ok;
+}
+//___________________________________________________________________________
+bool GMCJDriver::IsWorkerEvent(long int ievent) const
+{
+  return (ievent % fNWorkers) == fWorkerId;
+}
+//___________________________________________________________________________
 EventRecord * GMCJDriver::GenerateEvent1Try(void)
 {
 // attempt generating a neutrino interaction by firing a single flux neutrino
@@ -1081,12 +1542,17 @@ bool GMCJDriver::ComputePathLengths(void)
 // for all detector materials for the neutrino generated by the flux driver
 // and make sure that things look ok...
 
+  return this->ComputePathLengths(
+            fFluxDriver->Position(), fFluxDriver->Momentum());
+}
+//___________________________________________________________________________
+bool GMCJDriver::ComputePathLengths(
+           const TLorentzVector & nux4, const TLorentzVector & nup4)
+{
   fCurPathLengths.clear();
 
-  const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
-  const TLorentzVector & nux4  = fFluxDriver -> Position ();
-
   fCurPathLengths = fGeomAnalyzer->ComputePathLengths(nux4, nup4);
+  fCurPathLengths.PathLengths(fProbTgtPdg, fCurPl);
 
   LOG("GMCJDriver", pNOTICE) << fCurPathLengths;
 
@@ -1105,71 +1571,71 @@ bool GMCJDriver::ComputePathLengths(void)
 }
 //___________________________________________________________________________
 double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
+{
+  // current flux neutrino code & 4-p
+  return this->ComputeInteractionProbabilities(
+     fFluxDriver->PdgCode(), fFluxDriver->Momentum(), use_max_path_length);
+}
+//___________________________________________________________________________
+double GMCJDriver::ComputeInteractionProbabilities(
+     int nupdg, const TLorentzVector & nup4, bool use_max_path_length)
 {
   LOG("GMCJDriver", pNOTICE)
        << "Computing relative interaction probabilities for each material";
 
-  // current flux neutrino code & 4-p
-  int                    nupdg = fFluxDriver->PdgCode();
-  const TLorentzVector & nup4  = fFluxDriver->Momentum();
-
-  fCurCumulProbMap.clear();
+  double Ev = nup4.Energy();
 
-  const PathLengthList & path_length_list =
-        (use_max_path_length) ? fMaxPathLengths : fCurPathLengths;
+  int inu  = fGPool->NuIndex(nupdg);
+  int ntgt = fProbTgtPdg.size();
+  fCurNuIdx = inu;
+  if(inu < 0) {
+    LOG("GMCJDriver", pFATAL)
+      << "\n * The MC Job driver isn't properly configured!"
+      << "\n * No event generation drivers for flux neutrino: " << nupdg;
+    exit(1);
+  }
+  assert((int) fProbMaxPl.size() == ntgt && (int) fCurPl.size() == ntgt);
+  const Spline * const * xsec_spl = fProbXSecSpl.data() + inu*ntgt;
+  const double *         pl_list  = (use_max_path_length) ?
+                                     fProbMaxPl.data() : fCurPl.data();
+
+  // scale the interaction probability to the maximum one so as not
+  // to have to throw few billions of flux neutrinos before getting
+  // an interaction...
+  double pmax = 0;
+  if(fForceInteraction) pmax = 1.;
+  else if(fGenerateUnweighted) pmax = fGlobPmax;
+  else {
+     assert(fProbPmax.size() > 0);
+     int nbins = fProbPmaxEdges.size() - 1;
+     pmax = fProbPmax[inu*(nbins+2) + this->PmaxBin(Ev)];
+  }
 
   double probsum=0;
-  PathLengthList::const_iterator pliter;
-
-  for(pliter = path_length_list.begin();
-                            pliter != path_length_list.end(); ++pliter) {
-     int    mpdg  = pliter->first;            // material PDG code
-     double pl    = pliter->second;           // density x path-length
-     int    A     = pdg::IonPdgCodeToA(mpdg);
+  for(int itgt = 0; itgt < ntgt; itgt++) {
+     int    mpdg  = fProbTgtPdg[itgt];        // material PDG code
+     double pl    = pl_list[itgt];            // density x path-length
+     int    A     = fProbTgtA[itgt];
      double xsec  = 0.;                       // sum of xsecs for all modelled processes for given init state
      double prob  = 0.;                       // interaction probability
      double probn = 0.;                       // normalized interaction probability
 
-     // find the GEVGDriver object that is handling the current init state
-     InitialState init_state(mpdg, nupdg);
-     GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
-     if(!evgdriver) {
-       LOG("GMCJDriver", pFATAL)
-        << "\n * The MC Job driver isn't properly configured!"
-        << "\n * No event generation driver could be found for init state: "
-        << init_state.AsString();
-       exit(1);
-     }
      // compute the interaction xsec and probability (if path-length>0)
      if(pl>0.) {
-        const Spline * totxsecspl = evgdriver->XSecSumSpline();
+        const Spline * totxsecspl = xsec_spl[itgt];
         if(!totxsecspl) {
             LOG("GMCJDriver", pFATAL)
               << "\n * The MC Job driver isn't properly configured!"
               << "\n * Couldn't retrieve total cross section spline for init state: "
-              << init_state.AsString();
+              << InitialState(mpdg, nupdg).AsString();
             exit(1);
         } else {
-            xsec = totxsecspl->Evaluate( nup4.Energy() );
+            xsec = totxsecspl->Evaluate(Ev);
         }
         prob = this->InteractionProbability(xsec,pl,A);
         LOG("GMCJDriver", pDEBUG)
           << " (xsec, pl, A)=(" << xsec << "," << pl << "," << A << ")";
 
-        // scale the interaction probability to the maximum one so as not
-        // to have to throw few billions of flux neutrinos before getting
-        // an interaction...
-        double pmax = 0;
-        if(fForceInteraction) pmax = 1.;
-        else if(fGenerateUnweighted) pmax = fGlobPmax;
-        else {
-           map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nupdg);
-           assert(pmax_iter != fPmax.end());
-           TH1D * pmax_hst = pmax_iter->second;
-           assert(pmax_hst);
-           int    ie   = pmax_hst->FindBin(nup4.Energy());
-           pmax = pmax_hst->GetBinContent(ie);
-        }
         assert(pmax>0);
         LOG("GMCJDriver", pDEBUG)
           << "Pmax=" << pmax;
@@ -1182,7 +1648,7 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
 #endif
 
      probsum += probn;
-     fCurCumulProbMap.insert(map<int,double>::value_type(mpdg,probsum));
+     fCurCumulProb[itgt] = probsum;
   }
   return probsum;
 }
@@ -1194,11 +1660,13 @@ int GMCJDriver::SelectTargetMaterial(double R)
 
   LOG("GMCJDriver", pNOTICE) << "Selecting target material";
   int tgtpdg = 0;
-  map<int,double>::const_iterator probiter = fCurCumulProbMap.begin();
-  for( ; probiter != fCurCumulProbMap.end(); ++probiter) {
-     double prob = probiter->second;
+  int ntgt = fProbTgtPdg.size();
+  fSelTgtIdx = -1;
+  for(int itgt = 0; itgt < ntgt; itgt++) {
+     double prob = fCurCumulProb[itgt];
      if(R<prob) {
-        tgtpdg = probiter->first;
+        tgtpdg = fProbTgtPdg[itgt];
+        fSelTgtIdx = itgt;
         LOG("GMCJDriver", pNOTICE)
           << "Selected target material = " << tgtpdg;
         return tgtpdg;
@@ -1216,11 +1684,12 @@ void GMCJDriver::GenerateEventKinematics(void)
 
   // Find the GEVGDriver object that generates interactions for the
   // given initial state (neutrino + target)
-  InitialState init_state(fSelTgtPdg, nupdg);
-  GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+  GEVGDriver * evgdriver = (fCurNuIdx >= 0 && fSelTgtIdx >= 0) ?
+                            fGPool->Driver(fCurNuIdx, fSelTgtIdx) : 0;
   if(!evgdriver) {
      LOG("GMCJDriver", pFATAL)
-       << "No GEVGDriver object for init state: " << init_state.AsString();
+       << "No GEVGDriver object for init state: "
+       << InitialState(fSelTgtPdg, nupdg).AsString();
      exit(1);
   }
 
@@ -1269,11 +1738,10 @@ void GMCJDriver::ComputeEventProbability(void)
   double xsec = fCurEvt->XSec();
 
   // get path length in detector along v direction for specified target material
-  PathLengthList::const_iterator pliter = fCurPathLengths.find(fSelTgtPdg);
-  double path_length = pliter->second;
+  double path_length = fCurPl[fSelTgtIdx];
 
   // get target material mass number
-  int A = pdg::IonPdgCodeToA(fSelTgtPdg);
+  int A = fProbTgtA[fSelTgtIdx];
 
   // calculate interaction probability
   double P = this->InteractionProbability(xsec, path_length, A);
@@ -1283,16 +1751,14 @@ void GMCJDriver::ComputeEventProbability(void)
   //
 
   GHepParticle * nu = fCurEvt->Probe();
-  int    nu_pdg = nu->Pdg();
   double Ev     = nu->P4()->Energy();
 
   double weight = 1.0;
   if(!fGenerateUnweighted) {
-     map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nu_pdg);
-     assert(pmax_iter != fPmax.end());
-     TH1D * pmax_hst = pmax_iter->second;
-     assert(pmax_hst);
-     double pmax = pmax_hst->GetBinContent(pmax_hst->FindBin(Ev));
+     assert(fCurNuIdx >= 0);
+     assert(fProbPmax.size() > 0);
+     int    nbins = fProbPmaxEdges.size() - 1;
+     double pmax  = fProbPmax[fCurNuIdx*(nbins+2) + this->PmaxBin(Ev)];
      assert(pmax>0);
      weight = pmax/fGlobPmax;
   }
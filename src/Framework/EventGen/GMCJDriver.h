@@ -21,6 +21,7 @@
 #define _GENIE_MC_JOB_DRIVER_H_
 
 #include <string>
+#include <vector>
 #include <map>
 
 #include <TH1D.h>
@@ -33,6 +34,7 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 
 using std::string;
+using std::vector;
 using std::map;
 
 namespace genie {
@@ -42,6 +44,7 @@ class GFluxI;
 class GeomAnalyzerI;
 class GENIE;
 class GEVGPool;
+class Spline;
 
 class GMCJDriver {
 
@@ -66,12 +69,28 @@ public :
   void PreSelectEvents             (bool preselect = true);
   bool PreCalcFluxProbabilities    (void);
   bool LoadFluxProbabilities       (string filename);
-  void SaveFluxProbabilities       (string outfilename);
+  void SaveFluxProbabilities       (string outfilename, bool incremental = false);
+  void SetPreCalcWorkers           (int nworkers);
   void Configure                   (bool calc_prob_scales = true);
 
   // generate single neutrino event for input flux & geometry
   EventRecord * GenerateEvent (void);
 
+  // generate the event with the input (job-wide) index, re-seeding the random
+  // number generators from the (run seed, event index) pair first, so that
+  // the event does not depend on which worker generates it or on its history
+  EventRecord * GenerateEvent (long int ievent);
+
+  // multi-process event generation: split the job into worker processes
+  // (forked after Configure() so that splines, geometry and hadron transport
+  // tables are shared copy-on-write) each generating an interleaved subset
+  // of the job's event indices
+  int  ForkWorkers    (int nworkers);
+  bool WaitForWorkers (void);
+  bool IsWorkerEvent  (long int ievent) const;
+  int  WorkerId       (void) const { return fWorkerId; }
+  int  NWorkers       (void) const { return fNWorkers; }
+
   // info needed for computing the generated sample normalization
   double   GlobProbScale  (void) const { return fGlobPmax;                  }
   long int NFluxNeutrinos (void) const { return (long int) fNFluxNeutrinos; }
@@ -95,16 +114,38 @@ private:
   void          BootstrapXSecSplines            (void);
   void          BootstrapXSecSplineSummation    (void);
   void          ComputeProbScales               (void);
+  void          BuildProbTables                 (void);
+  int           PmaxBin                         (double Ev) const;
   EventRecord * GenerateEvent1Try               (void);
   bool          GenerateFluxNeutrino            (void);
   bool          ComputePathLengths              (void);
+  bool          ComputePathLengths              (const TLorentzVector & nux4, const TLorentzVector & nup4);
   double	ComputeInteractionProbabilities (bool use_max_path_length);
+  double        ComputeInteractionProbabilities (int nupdg, const TLorentzVector & nup4, bool use_max_path_length);
   int           SelectTargetMaterial            (double R);
   void          GenerateEventKinematics         (void);
   void          GenerateVertexPosition          (void);
   void          ComputeEventProbability         (void);
   double        InteractionProbability          (double xsec, double pl, int A);
   double        PreGenFluxInteractionProbability(void);
+  TTree *       NewFluxProbTree                 (void);
+
+  // a flux neutrino, as recorded for the flux interaction probability workers
+  struct FluxRay {
+    int    index;   ///< flux entry
+    int    pdg;     ///< neutrino code
+    double weight;  ///< flux weight
+    double p4[4];   ///< 4-momentum (px,py,pz,E)
+    double x4[4];   ///< 4-position (x,y,z,t)
+  };
+
+  void          CurrentFluxRay                  (FluxRay & ray) const;
+  bool          ReadFluxRays                    (vector<FluxRay> & rays);
+  TTree *       OpenFluxProbReuseTree           (string reuse_file, TFile *& file);
+  bool          FillFluxProbEntry               (TTree * tree, TTree * prev_tree, const FluxRay & ray, bool & reused);
+  bool          FillFluxProbTree                (TTree * tree, string reuse_file);
+  bool          FillFluxProbTree                (TTree * tree, const vector<FluxRay> & rays, int iworker, int nworkers, string reuse_file);
+  bool          PreCalcFluxProbabilitiesMP      (string reuse_file);
 
   // private data members:
   GEVGPool *      fGPool;              ///< A pool of GEVGDrivers properly configured event generation drivers / one per init state
@@ -118,12 +159,15 @@ private:
   TLorentzVector  fCurVtx;             ///< [current] interaction vertex
   EventRecord *   fCurEvt;             ///< [current] generated event
   int             fSelTgtPdg;          ///< [current] selected target material PDG code
-  map<int,double> fCurCumulProbMap;    ///< [current] cummulative interaction probabilities
+  int             fSelTgtIdx;          ///< [current] selected target material index (fProbTgtPdg order)
+  int             fCurNuIdx;           ///< [current] flux neutrino index (fNuList order)
+  vector<double>  fCurPl;              ///< [current] path lengths (fProbTgtPdg order)
+  vector<double>  fCurCumulProb;       ///< [current] cummulative interaction probabilities (fProbTgtPdg order)
   double          fNFluxNeutrinos;     ///< [current] number of flux nuetrinos fired by the flux driver so far 
   int             fXSecSplineNbins;    ///< [config] number of bins in energy used in the xsec splines
   bool            fPmaxLogBinning;     ///< [config] maximum interaction probability is computed in logarithmic energy bins
   int             fPmaxNbins;          ///< [config] number of bins in energy used in the maximum interaction probability
-  double          fPmaxSafetyFactor;   ///< [config] safety factor to compute the maximum interaction probability
+  double          fPmaxSafetyFactor;   ///< [config] safety factor to compute the maximum interaction probability (applied to the max path lengths)
   map<int,TH1D*>  fPmax;               ///< [computed at init] interaction probability scale /neutrino /energy for given geometry
   double          fGlobPmax;           ///< [computed at init] global interaction probability scale for given flux & geometry
   string          fEventGenList;       ///< [config] list of event generators loaded by this driver (what used to be the $GEVGL setting)
@@ -145,7 +189,18 @@ private:
   int             fBrFluxPDG;          ///< corresponding flux pdg code (set to address of branch: "FluxPDG")
   string          fFluxIntFileName;    ///< whether to save pre-generated flux tree for use in later jobs
   string          fFluxIntTreeName;    ///< name for tree holding flux probabilities
+  bool            fFluxIntIncremental; ///< [config] reuse the probabilities already in the flux probabilities output file?
+  int             fNPreCalcWorkers;    ///< [config] number of processes pre-calculating the flux interaction probabilities
   map<int, double> fSumFluxIntProbs;   ///< map where the key is flux pdg code and the value is sum of fBrFluxWeight * fBrFluxIntProb for all these flux neutrinos
+  vector<int>     fProbTgtPdg;         ///< [computed at init] target PDG codes, in PathLengthList order
+  vector<int>     fProbTgtA;           ///< [computed at init] target mass numbers
+  vector<double>  fProbMaxPl;          ///< [computed at init] target max path lengths
+  vector<const Spline *> fProbXSecSpl; ///< [computed at init] total xsec spline at [neutrino index * number of targets + target index] (as in fGPool index)
+  vector<double>  fProbPmaxEdges;      ///< [computed at init] energy bin edges of the interaction probability scales
+  vector<double>  fProbPmax;           ///< [computed at init] interaction probability scale at [neutrino index * (number of bins + 2) + bin] (as in fPmax, incl. under/overflow)
+  int             fNWorkers;           ///< [config] number of worker processes sharing this job
+  int             fWorkerId;           ///< [config] index of this worker process (0 for the parent process)
+  vector<int>     fWorkerPids;         ///< [parent only] process ids of the forked workers
 };
 
 }      // genie namespace
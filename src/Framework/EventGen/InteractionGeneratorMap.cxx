@@ -17,8 +17,10 @@
 #include "Framework/EventGen/InteractionGeneratorMap.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/XSecSplineList.h"
 
 using std::setw;
 using std::setfill;
@@ -64,6 +66,9 @@ void InteractionGeneratorMap::Init(void)
 
   fInitState       = new InitialState;
   fInteractionList = new InteractionList;
+
+  fXSecSplineHandles.clear();
+  fXSecSplineGeneration = 0;
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::CleanUp(void)
@@ -81,6 +86,9 @@ void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
   fInitState       -> Copy (*xsmap.fInitState);
   fInteractionList -> Copy (*xsmap.fInteractionList);
 
+  fXSecSplineHandles    = xsmap.fXSecSplineHandles;
+  fXSecSplineGeneration = xsmap.fXSecSplineGeneration;
+
   this->clear();
 
   InteractionGeneratorMap::const_iterator iter;
@@ -111,6 +119,7 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
   }
 
   fInitState->Copy(init_state);
+  fXSecSplineHandles.clear();
 
   EventGeneratorList::const_iterator evgliter; // event generator list iter
   InteractionList::iterator          intliter; // interaction list iter
@@ -177,6 +186,55 @@ const InteractionList & InteractionGeneratorMap::GetInteractionList(void) const
   return *fInteractionList;
 }
 //___________________________________________________________________________
+bool InteractionGeneratorMap::ResolveXSecSplines(void) const
+{
+  XSecSplineList * xsl = XSecSplineList::Instance();
+
+  fXSecSplineHandles.clear();
+  fXSecSplineGeneration = xsl->Generation();
+
+  InteractionList::const_iterator intliter = fInteractionList->begin();
+  for( ; intliter != fInteractionList->end(); ++intliter) {
+
+    const Interaction * interaction = *intliter;
+
+    const EventGeneratorI * evgen = this->FindGenerator(interaction);
+    const XSecAlgorithmI * xsec_alg = (evgen) ? evgen->CrossSectionAlg() : 0;
+    if(!xsec_alg) {
+      LOG("IntGenMap", pWARN)
+        << "Null cross-section algorithm! Can not load cross-section spline.";
+      fXSecSplineHandles.clear();
+      return false;
+    }
+
+    int handle = xsl->SplineHandle(xsec_alg, interaction);
+    if(handle < 0) {
+      LOG("IntGenMap", pWARN)
+         << "*** At least a spline (algorithm: "
+         << xsec_alg->Id().Key() << ", interaction: "
+         << interaction->AsString() << ") doesn't exist.";
+      fXSecSplineHandles.clear();
+      return false;
+    }
+    fXSecSplineHandles.push_back(handle);
+  }
+  return true;
+}
+//___________________________________________________________________________
+const Spline * InteractionGeneratorMap::XSecSpline(unsigned int iint) const
+{
+  if(iint >= fXSecSplineHandles.size()) return 0;
+
+  // the handles are invalidated when the spline list is reset
+  XSecSplineList * xsl = XSecSplineList::Instance();
+  if(fXSecSplineGeneration != xsl->Generation()) {
+    LOG("IntGenMap", pNOTICE)
+      << "The cross section spline list was reset: Resolving the splines again";
+    if(!this->ResolveXSecSplines()) return 0;
+  }
+  return xsl->GetSpline(fXSecSplineHandles[iint]);
+}
+//___________________________________________________________________________
 void InteractionGeneratorMap::Print(ostream & stream) const
 {
   stream << endl;
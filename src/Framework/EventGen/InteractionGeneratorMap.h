@@ -22,12 +22,14 @@
 #define _INTERACTION_GENERATOR_MAP_H_
 
 #include <map>
+#include <vector>
 #include <string>
 #include <ostream>
 
 #include "Framework/Interaction/Interaction.h"
 
 using std::map;
+using std::vector;
 using std::string;
 using std::ostream;
 
@@ -38,6 +40,7 @@ class EventGeneratorI;
 class InteractionList;
 class InitialState;
 class EventGeneratorList;
+class Spline;
 
 ostream & operator << (ostream & stream, const InteractionGeneratorMap & xsmap);
 
@@ -54,6 +57,14 @@ public :
   const EventGeneratorI * FindGenerator      (const Interaction * in) const;
   const InteractionList & GetInteractionList (void) const;
 
+  //! Look-up, once, the cross section spline of each interaction in the list
+  //! (for the current tune). Returns false if any spline is missing.
+  bool           ResolveXSecSplines (void) const;
+  //! Cross section spline for the i^th interaction in the list,
+  //! or 0 if the splines have not been resolved. The splines are resolved
+  //! again if the XSecSplineList was reset since.
+  const Spline * XSecSpline         (unsigned int iint) const;
+
   void Reset (void);
   void Copy  (const InteractionGeneratorMap & xsmap);
   void Print (ostream & stream) const;
@@ -70,6 +81,8 @@ private:
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+  mutable vector<int>  fXSecSplineHandles;    ///< see XSecSplineList::SplineHandle
+  mutable unsigned int fXSecSplineGeneration; ///< XSecSplineList generation of the handles
 };
 
 }      // genie namespace
@@ -132,6 +132,26 @@ double PathLengthList::PathLength(int pdgc) const
   return 0;
 }
 //___________________________________________________________________________
+void PathLengthList::PathLengths(
+              const vector<int> & pdglist, vector<double> & pl) const
+{
+// Copies the path lengths for the input list of material codes into the
+// input vector (0 for codes not in this list). If the input codes are
+// sorted, as the ones in this list, it takes a single pass.
+
+  int n = pdglist.size();
+  pl.resize(n);
+
+  PathLengthList::const_iterator pl_iter = this->begin();
+  for(int i = 0; i < n; i++) {
+    int pdgc = pdglist[i];
+    if(i > 0 && pdgc < pdglist[i-1]) pl_iter = this->begin();
+    while(pl_iter != this->end() && pl_iter->first < pdgc) ++pl_iter;
+    pl[i] = (pl_iter != this->end() && pl_iter->first == pdgc) ?
+             pl_iter->second : 0.;
+  }
+}
+//___________________________________________________________________________
 void PathLengthList::SetAllToZero(void)
 {
   PathLengthList::const_iterator pl_iter;
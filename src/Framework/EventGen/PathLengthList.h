@@ -21,6 +21,7 @@
 #define _PATH_LENGTH_LIST_H_
 
 #include <map>
+#include <vector>
 #include <ostream>
 #include <string>
 
@@ -29,6 +30,7 @@
 class TLorentzVector;
 
 using std::map;
+using std::vector;
 using std::ostream;
 using std::string;
 
@@ -54,6 +56,7 @@ public :
   bool   AreAllZero      (void) const;
   void   ScalePathLength (int pdgc, double scale);
   double PathLength      (int pdgc) const;
+  void   PathLengths     (const vector<int> & pdglist, vector<double> & pl) const;
 
   XmlParserStatus_t LoadFromXml (string filename);
   void              SaveAsXml   (string filename) const;
@@ -12,6 +12,7 @@
 #include <sstream>
 #include <cstdlib>
 #include <iomanip>
+#include <algorithm>
 
 #include <TMath.h>
 #include <TLorentzVector.h>
@@ -20,13 +21,13 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/PhysInteractionSelector.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
-#include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
 
 using std::vector;
@@ -42,18 +43,18 @@ using namespace genie;
 PhysInteractionSelector::PhysInteractionSelector() :
 InteractionSelectorI("genie::PhysInteractionSelector")
 {
-
+  fInteraction = new Interaction;
 }
 //___________________________________________________________________________
 PhysInteractionSelector::PhysInteractionSelector(string config) :
 InteractionSelectorI("genie::PhysInteractionSelector", config)
 {
-
+  fInteraction = new Interaction;
 }
 //___________________________________________________________________________
 PhysInteractionSelector::~PhysInteractionSelector()
 {
-
+  delete fInteraction;
 }
 //___________________________________________________________________________
 EventRecord * PhysInteractionSelector::SelectInteraction
@@ -70,53 +71,39 @@ EventRecord * PhysInteractionSelector::SelectInteraction
      return 0;
   }
 
-  // Get the list of spline objects
-  // Should have been constructed at the job initialization
-  XSecSplineList * xssl = 0;
-  if (fUseSplines) xssl = XSecSplineList::Instance();
-
   const InteractionList & ilst = igmap->GetInteractionList();
-  vector<double> xseclist(ilst.size());
-
-  string istate = ilst[0]->InitState().AsString();
-  ostringstream msg;
-  msg << "Selecting an interaction for the given initial state = "
-      << istate << " at E = " << p4.E() << " GeV";
-
-  LOG("IntSel", pNOTICE)
-             << utils::print::PrintFramedMesg(msg.str(), 0, '=');
-  LOG("IntSel", pNOTICE)
-     << "Computing xsecs for all relevant modeled interactions:";
-
-  unsigned int i=0;
-  InteractionList::const_iterator intliter = ilst.begin();
+  unsigned int nint = ilst.size();
+
+  bool print_table = Messenger::IsEnabled("IntSel", pNOTICE);
+  if(print_table) {
+    ostringstream msg;
+    msg << "Selecting an interaction for the given initial state = "
+        << ilst[0]->InitState().AsString() << " at E = " << p4.E() << " GeV";
+    LOG("IntSel", pNOTICE)
+       << utils::print::PrintFramedMesg(msg.str(), 0, '=');
+    LOG("IntSel", pNOTICE)
+       << "Computing xsecs for all relevant modeled interactions:";
+  }
 
-  ostringstream xsec_table_printout;
+  // compute the cumulative cross sections
+  fXSecSum.resize(nint);
+  double xsec_sum = 0;
 
-  xsec_table_printout
-      << " |"  << setfill('-') << setw(112) << "|" << endl
-      << " | " << setfill(' ') << setw(80) << "interaction"
-      << " | cross-section (1E-38*cm^2) |" << endl
-      << " |"  << setfill('-') << setw(112) << "|" << endl;
+  for(unsigned int i = 0; i < nint; i++) {
 
-  for( ; intliter != ilst.end(); ++intliter) {
-
-     Interaction * interaction = new Interaction(**intliter);
+     Interaction * interaction = fInteraction;
+     interaction->Copy(*ilst[i]);
      interaction->InitStatePtr()->SetProbeP4(p4);
 
      SLOG("IntSel", pDEBUG)
            << "Computing xsec for: \n  " << interaction->AsString();
 
-     // get the cross section for this interaction
-     const XSecAlgorithmI * xsec_alg =
-               igmap->FindGenerator(interaction)->CrossSectionAlg();
-     assert(xsec_alg);
-
      double xsec = 0; // cross section for this interaction
 
-     bool spline_computed = xssl->SplineExists(xsec_alg, interaction);
-     bool eval = fUseSplines && spline_computed;
-     if (eval) {
+     // cross section spline, as resolved when the driver was asked to
+     // use splines (see GEVGDriver::UseSplines)
+     const Spline * spl = (fUseSplines) ? igmap->XSecSpline(i) : 0;
+     if (spl) {
            const InitialState & init = interaction->InitState();
            const ProcessInfo & proc  = interaction->ProcInfo();
            // choose ref frame ('Lab' or 'Hit nucleon rest frame')
@@ -129,81 +116,93 @@ EventRecord * PhysInteractionSelector::SelectInteraction
     		 BLOG("IntSel", pFATAL) << "E = " << E;
 		 abort();
 	   }
-           const Spline * spl = xssl->GetSpline(xsec_alg,interaction);
-           if(spl->ClosestKnotValueIsZero(E,"-")) xsec = 0;
-           else xsec = spl->Evaluate(E);
+           xsec = spl->EvaluateIfLowerKnotNonZero(E);
      } else {
+           // get the cross section algorithm for this interaction
+           const XSecAlgorithmI * xsec_alg =
+                     igmap->FindGenerator(interaction)->CrossSectionAlg();
+           assert(xsec_alg);
            xsec = xsec_alg->Integral(interaction);
      }
-     TMath::Max(0., xsec);
-/*
-     LOG("IntSel", pNOTICE)
-       << interaction->AsString()
-       << " --> xsec " << (eval ? "[**interp**]" : "[**calc**]")
-       << " = " << xsec/genie::units::cm2 << " cm^2";
-*/
-     xsec_table_printout
-           << " | " << setfill(' ') << setw(80) << interaction->AsString()
-           << " | " << setfill(' ') << setw(26) << xsec/(1E-38*genie::units::cm2)
-           << " | " << endl;
+     xsec = TMath::Max(0., xsec);
 
-     xseclist[i++] = xsec;
-     delete interaction;
+     xsec_sum   += xsec;
+     fXSecSum[i] = xsec_sum;
 
-  } // loop over interaction that can be generated
+     SLOG("IntSel", pINFO)
+             << "Sum{xsec}(0->" << i << ") = " << xsec_sum;
 
-  xsec_table_printout
-      << " |"  << setfill('-') << setw(112) << "|" << endl;
+  } // loop over interaction that can be generated
 
-  LOG("IntSel", pNOTICE)
-    << "\n" << xsec_table_printout.str();
+  if(print_table) this->PrintXSecTable(ilst, p4);
 
-  // select an interaction
+  // select an interaction: the first one whose cumulative xsec exceeds R
 
-  LOG("IntSel", pINFO)
-            << "Selecting an entry from the Interaction List";
-  double xsec_sum  = 0;
-  for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
-     xsec_sum       += xseclist[iint];
-     xseclist[iint]  = xsec_sum;
-
-     SLOG("IntSel", pINFO)
-             << "Sum{xsec}(0->" << iint << ") = " << xsec_sum;
-  }
   RandomGen * rnd = RandomGen::Instance();
   double R = xsec_sum * rnd->RndISel().Rndm();
 
   LOG("IntSel", pINFO)
       << "Generating Rndm (0. -> max = " << xsec_sum << ") = " << R;
 
-  for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
+  vector<double>::const_iterator sel =
+     std::upper_bound(fXSecSum.begin(), fXSecSum.end(), R);
+  if(sel == fXSecSum.end()) {
+     LOG("IntSel", pERROR) << "Could not select interaction";
+     return 0;
+  }
+  unsigned int iint = sel - fXSecSum.begin();
 
-     SLOG("IntSel", pDEBUG)
-               << "Sum{xsec}(0->" << iint <<") = " << xseclist[iint];
+  Interaction * selected_interaction = new Interaction (*ilst[iint]);
+  selected_interaction->InitStatePtr()->SetProbeP4(p4);
 
-     if( R < xseclist[iint] ) {
-       Interaction * selected_interaction = new Interaction (*ilst[iint]);
-       selected_interaction->InitStatePtr()->SetProbeP4(p4);
+  // set the cross section for the selected interaction (just extract it
+  // from the array of summed xsecs rather than recomputing it)
+  double xsec_pedestal = (iint > 0) ? fXSecSum[iint-1] : 0.;
+  double xsec = fXSecSum[iint] - xsec_pedestal;
+  assert(xsec>0);
 
-       // set the cross section for the selected interaction (just extract it
-       // from the array of summed xsecs rather than recomputing it)
-       double xsec_pedestal = (iint > 0) ? xseclist[iint-1] : 0.;
-       double xsec = xseclist[iint] - xsec_pedestal;
-       assert(xsec>0);
+  LOG("IntSel", pNOTICE)
+    << "Selected interaction: " << selected_interaction->AsString();
 
-       LOG("IntSel", pNOTICE)
-         << "Selected interaction: " << selected_interaction->AsString();
+  // bootstrap the event record
+  EventRecord * evrec = EventRecordPool::Instance()->Get();
+  evrec->AttachSummary(selected_interaction);
+  evrec->SetXSec(xsec);
 
-       // bootstrap the event record
-       EventRecord * evrec = new EventRecord;
-       evrec->AttachSummary(selected_interaction);
-       evrec->SetXSec(xsec);
+  return evrec;
+}
+//___________________________________________________________________________
+void PhysInteractionSelector::PrintXSecTable(
+   const InteractionList & ilst, const TLorentzVector & p4) const
+{
+// Prints the cross section of each interaction, as computed in the last
+// SelectInteraction call (from the cumulative cross sections)
 
-       return evrec;
-     }
+  ostringstream xsec_table_printout;
+
+  xsec_table_printout
+      << " |"  << setfill('-') << setw(112) << "|" << endl
+      << " | " << setfill(' ') << setw(80) << "interaction"
+      << " | cross-section (1E-38*cm^2) |" << endl
+      << " |"  << setfill('-') << setw(112) << "|" << endl;
+
+  for(unsigned int i = 0; i < ilst.size(); i++) {
+     fInteraction->Copy(*ilst[i]);
+     fInteraction->InitStatePtr()->SetProbeP4(p4);
+
+     double xsec = fXSecSum[i] - ((i > 0) ? fXSecSum[i-1] : 0.);
+
+     xsec_table_printout
+           << " | " << setfill(' ') << setw(80) << fInteraction->AsString()
+           << " | " << setfill(' ') << setw(26) << xsec/(1E-38*genie::units::cm2)
+           << " | " << endl;
   }
-  LOG("IntSel", pERROR) << "Could not select interaction";
-  return 0;
+
+  xsec_table_printout
+      << " |"  << setfill('-') << setw(112) << "|" << endl;
+
+  LOG("IntSel", pNOTICE)
+    << "\n" << xsec_table_printout.str();
 }
 //___________________________________________________________________________
 void PhysInteractionSelector::Configure(const Registry & config)
@@ -6,6 +6,9 @@
 \brief   Selects interactions to be generated
 
          Is a concrete implementation of the InteractionSelectorI interface.
+         The interaction is picked from the cumulative cross sections by a
+         binary search. The per-interaction cross section table is printed
+         (and built) only if the IntSel message stream is at NOTICE level.
 
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -20,10 +23,17 @@
 #ifndef _PHYS_INTERACTION_SELECTOR_H_
 #define _PHYS_INTERACTION_SELECTOR_H_
 
+#include <vector>
+
 #include "Framework/EventGen/InteractionSelectorI.h"
 
+using std::vector;
+
 namespace genie {
 
+class Interaction;
+class InteractionList;
+
 class PhysInteractionSelector : public InteractionSelectorI {
 
 public :
@@ -43,7 +53,13 @@ public :
 private:
   void LoadConfigData (void);
 
+  void PrintXSecTable (const InteractionList & ilst,
+                       const TLorentzVector & p4) const;
+
   bool fUseSplines;
+
+  Interaction *         fInteraction; ///< reused for computing the xsec of each interaction
+  mutable vector<double> fXSecSum;     ///< cumulative xsecs, reused between events
 };
 
 }      // genie namespace
@@ -12,6 +12,7 @@
 
 #include "Framework/EventGen/ToyInteractionSelector.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
 #include "Framework/Interaction/Interaction.h"
@@ -71,7 +72,7 @@ EventRecord * ToyInteractionSelector::SelectInteraction
              << "Interaction to generate: \n" << *selected_interaction;
 
   // bootstrap the event record
-  EventRecord * evrec = new EventRecord;
+  EventRecord * evrec = EventRecordPool::Instance()->Get();
   evrec->AttachSummary(selected_interaction);
 
   return evrec;
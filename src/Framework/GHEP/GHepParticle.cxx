@@ -62,13 +62,12 @@ fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
 fFirstDaughter(daughter1),
-fLastDaughter(daughter2)
+fLastDaughter(daughter2),
+fP4(p),
+fX4(v)
 {
   this->SetPdgCode(pdg);
 
-  fP4 = new TLorentzVector(p);
-  fX4 = new TLorentzVector(v);
-
   fRescatterCode  = -1;
   fPolzTheta      = -999;
   fPolzPhi        = -999;
@@ -86,13 +85,12 @@ fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
 fFirstDaughter(daughter1),
-fLastDaughter(daughter2)
+fLastDaughter(daughter2),
+fP4(px,py,pz,En),
+fX4(x,y,z,t)
 {
   this->SetPdgCode(pdg);
 
-  fP4 = new TLorentzVector(px,py,pz,En);
-  fX4 = new TLorentzVector(x,y,z,t);
-
   fRescatterCode  = -1;
   fPolzTheta      = -999;
   fPolzPhi        = -999;
@@ -117,8 +115,8 @@ fFirstMother(-1),
 fLastMother(-1),
 fFirstDaughter(-1),
 fLastDaughter(-1),
-fP4(0),
-fX4(0),
+fP4(0,0,0,0),
+fX4(0,0,0,0),
 fPolzTheta(-999.),
 fPolzPhi(-999.),
 fRemovalEnergy(0),
@@ -129,7 +127,7 @@ fIsBound(false)
 //___________________________________________________________________________
 GHepParticle::~GHepParticle()
 {
-  this->CleanUp();
+
 }
 //___________________________________________________________________________
 string GHepParticle::Name(void) const
@@ -158,13 +156,8 @@ double GHepParticle::Charge(void) const
 //___________________________________________________________________________
 double GHepParticle::KinE(bool mass_from_pdg) const
 {
-  if(!fP4) {
-    LOG("GHepParticle", pWARN) << "4-momentum not yet set!";
-    return 0;
-  }
-
-  double En = fP4->Energy();
-  double M = ( (mass_from_pdg) ? this->Mass() : fP4->M() );
+  double En = fP4.Energy();
+  double M = ( (mass_from_pdg) ? this->Mass() : fP4.M() );
   double K = En - M;
 
   K = TMath::Max(K,0.);
@@ -196,17 +189,12 @@ TLorentzVector * GHepParticle::GetP4(void) const
 // see GHepParticle::P4() for a method that does not create a new object and
 // transfers its ownership
 
-  if(fP4) {
-     TLorentzVector * p4 = new TLorentzVector(*fP4);
+  TLorentzVector * p4 = new TLorentzVector(fP4);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG)
-          << "Return vp = " << utils::print::P4AsShortString(p4);
+  LOG("GHepParticle", pDEBUG)
+       << "Return vp = " << utils::print::P4AsShortString(p4);
 #endif
-     return p4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-momentum TLorentzVector";
-    return 0;
-  }
+  return p4;
 }
 //___________________________________________________________________________
 TLorentzVector * GHepParticle::GetX4(void) const
@@ -214,17 +202,12 @@ TLorentzVector * GHepParticle::GetX4(void) const
 // see GHepParticle::X4() for a method that does not create a new object and
 // transfers its ownership
 
-  if(fX4) {
-     TLorentzVector * x4 = new TLorentzVector(*fX4);
+  TLorentzVector * x4 = new TLorentzVector(fX4);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG)
-         << "Return x4 = " << utils::print::X4AsString(x4);
+  LOG("GHepParticle", pDEBUG)
+      << "Return x4 = " << utils::print::X4AsString(x4);
 #endif
-     return x4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-position TLorentzVector";
-    return 0;
-  }
+  return x4;
 }
 //___________________________________________________________________________
 void GHepParticle::SetPdgCode(int code)
@@ -235,18 +218,12 @@ void GHepParticle::SetPdgCode(int code)
 //___________________________________________________________________________
 void GHepParticle::SetMomentum(const TLorentzVector & p4)
 {
-  if(fP4)
-      fP4->SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
-  else
-      fP4 = new TLorentzVector(p4);
+  fP4.SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
 }
 //___________________________________________________________________________
 void GHepParticle::SetMomentum(double px, double py, double pz, double En)
 {
-  if(fP4)
-      fP4->SetPxPyPzE(px, py, pz, En);
-  else
-      fP4 = new TLorentzVector(px, py, pz, En);
+  fP4.SetPxPyPzE(px, py, pz, En);
 }
 //___________________________________________________________________________
 void GHepParticle::SetPosition(const TLorentzVector & v4)
@@ -262,8 +239,7 @@ void GHepParticle::SetPosition(double x, double y, double z, double t)
                                << y << ", z = " << z << ", t = " << t << ")";
 #endif
 
-  if(fX4) fX4->SetXYZT(x,y,z,t);
-  else    fX4 = new TLorentzVector(x,y,z,t);
+  fX4.SetXYZT(x,y,z,t);
 }
 //___________________________________________________________________________
 void GHepParticle::SetEnergy(double En)
@@ -293,7 +269,7 @@ bool GHepParticle::IsOnMassShell(void) const
   TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
 
   double Mpdg = p->Mass();
-  double M4p  = (fP4) ? fP4->M() : 0.;
+  double M4p  = fP4.M();
 
 //  return utils::math::AreEqual(Mpdg, M4p);
 
@@ -398,23 +374,21 @@ void GHepParticle::Init(void)
   fPolzPhi       = -999;
   fIsBound       = false;
   fRemovalEnergy = 0.;
-  fP4            = new TLorentzVector(0,0,0,0);
-  fX4            = new TLorentzVector(0,0,0,0);
+  fP4.SetXYZT(0,0,0,0);
+  fX4.SetXYZT(0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::CleanUp(void)
 {
-// deallocate memory
+// reset the 4-vectors (held by value: there is no memory to deallocate)
 
-  if(fP4) delete fP4;
-  if(fX4) delete fX4;
-  fP4 = 0;
-  fX4 = 0;
+  fP4.SetXYZT(0,0,0,0);
+  fX4.SetXYZT(0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::Reset(void)
 {
-// deallocate memory + initialize
+// reset + initialize
 
   this->CleanUp();
   this->Init();
@@ -423,8 +397,8 @@ void GHepParticle::Reset(void)
 void GHepParticle::Clear(Option_t * /*option*/)
 {
 // implement the Clear(Option_t *) method so that the GHepParticle when is a
-// member of a GHepRecord, gets deleted properly when calling TClonesArray's
-// Clear("C")
+// member of a GHepRecord, gets reset properly when calling TClonesArray's
+// Clear("C") (the slot is then reused without any memory allocation)
 
   this->CleanUp();
 }
@@ -865,11 +865,35 @@ void GHepRecord::CleanRecord(void)
 //___________________________________________________________________________
 void GHepRecord::ResetRecord(void)
 {
+// Resets the record so that it can be reused for a new event. The particle
+// slots, vertex and flag / mask objects are kept (and reset), so that
+// refilling a recycled record does not allocate any memory.
+
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pDEBUG) << "Reseting GHepRecord";
 #endif
-  this->CleanRecord();
-  this->InitRecord();
+  if(!fVtx || !fEventFlags || !fEventMask) {
+    this->CleanRecord();
+    this->InitRecord();
+    return;
+  }
+
+  if (fInteraction) delete fInteraction;
+  fInteraction = 0;
+
+  TClonesArray::Clear("C");
+
+  fWeight       = 1.;
+  fProb         = 1.;
+  fXSec         = 0.;
+  fDiffXSec     = 0.;
+  fDiffXSecPhSp = kPSNull;
+  fVtx->SetXYZT(0,0,0,0);
+
+  fEventFlags->ResetAllBits(false);
+  for(unsigned int i = 0; i < GHepFlags::NFlags(); i++) {
+   fEventMask->SetBitNumber(i, true);
+  }
 }
 //___________________________________________________________________________
 void GHepRecord::Clear(Option_t * opt)
@@ -8,6 +8,13 @@
 #pragma link C++ namespace genie::utils::ghep;
 
 #pragma link C++ class genie::GHepParticle+;
+
+// GHepParticle v3 holds its 4-vectors by value (heap-allocated up to v2)
+#pragma read sourceClass="genie::GHepParticle" targetClass="genie::GHepParticle" \
+  version="[-2]" source="TLorentzVector* fP4; TLorentzVector* fX4" target="fP4,fX4" \
+  code="{ if(onfile.fP4) fP4 = *onfile.fP4; else fP4.SetXYZT(0,0,0,0); \
+          if(onfile.fX4) fX4 = *onfile.fX4; else fX4.SetXYZT(0,0,0,0); }"
+
 #pragma link C++ class genie::GHepRecord+;
 #pragma link C++ class genie::GHepRecordHistory;
 #pragma link C++ class genie::GHepVirtualList;
@@ -35,6 +35,9 @@ bool genie::gAbortingInErr = false;
 
 //____________________________________________________________________________
 Messenger * Messenger::fInstance = 0;
+Messenger::StreamThreshold Messenger::fStreamThresholds[kNStreamThresholds];
+unsigned int Messenger::fGeneration = 1;
+thread_local bool Messenger::fThreadDisabled = false;
 //____________________________________________________________________________
 Messenger::Messenger()
 {
@@ -44,6 +47,7 @@ Messenger::Messenger()
 Messenger::~Messenger()
 {
   fInstance = 0;
+  fGeneration++; // look up the streams again if re-instantiated
 }
 //____________________________________________________________________________
 Messenger * Messenger::Instance()
@@ -91,6 +95,23 @@ void Messenger::SetPriorityLevel(
   log4cpp::Category & MSG = log4cpp::Category::getInstance(stream);
 
   MSG.setPriority(priority);
+
+  fGeneration++; // invalidate all cached thresholds (they are inherited)
+}
+//____________________________________________________________________________
+void Messenger::LookUpStream(const char * stream, StreamThreshold & entry)
+{
+// Caches the priority threshold of the input stream, as used by log4cpp
+// for filtering messages
+
+  Messenger::Instance(); // sets the priority levels at the 1st call
+
+  log4cpp::Category & MSG = log4cpp::Category::getInstance(stream);
+
+  entry.fStream     = stream;
+  entry.fName       = MSG.getName().c_str();
+  entry.fThreshold  = MSG.getChainedPriority();
+  entry.fGeneration = fGeneration;
 }
 //____________________________________________________________________________
 void Messenger::Configure(void)
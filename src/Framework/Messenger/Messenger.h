@@ -5,6 +5,11 @@
 
 \brief    A more convenient interface to the log4cpp Message Service
 
+          The LOG macros check the message priority before building the
+          message: A filtered message costs a cached threshold lookup and
+          its streamed arguments are not evaluated. Messages below the
+          __GENIE_MESG_PRIORITY_FLOOR__ priority are removed at compile time.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -74,6 +79,29 @@ using std::string;
   #define ENDL std::endl
 #endif
 
+/*!
+  \def   __GENIE_MESG_PRIORITY_FLOOR__
+  \brief The lowest message priority compiled in. Messages with a lower
+         priority (eg DEBUG & INFO for a floor of NOTICE) are compiled out.
+         Set at the configuration step (see --with-mesg-floor).
+*/
+
+#ifndef __GENIE_MESG_PRIORITY_FLOOR__
+  #define __GENIE_MESG_PRIORITY_FLOOR__ 700 // log4cpp::Priority::DEBUG
+#endif
+
+/*!
+  \def   GMSG_IF_ENABLED(stream, priority)
+  \brief Evaluates the message streaming expression that follows only if the
+         input priority passes both the compile-time floor and the threshold
+         of the input stream. Used by all the LOG macros below.
+*/
+
+#define GMSG_IF_ENABLED(stream, priority) \
+           !( (priority) <= __GENIE_MESG_PRIORITY_FLOOR__ && \
+              genie::Messenger::IsEnabled(stream, priority) ) ? (void) 0 : \
+           genie::MessageSink() &
+
 /*!
   \def   SLOG(stream, priority)
   \brief A macro that returns the requested log4cpp::Category
@@ -82,6 +110,7 @@ using std::string;
 */
 
 #define SLOG(stream, priority) \
+           GMSG_IF_ENABLED(stream, priority) \
            (*Messenger::Instance())(stream) \
                << priority << "[s] <" \
                << __FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -94,6 +123,7 @@ using std::string;
 */
 
 #define LOG(stream, priority) \
+           GMSG_IF_ENABLED(stream, priority) \
            (*Messenger::Instance())(stream) \
                << priority << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -110,41 +140,49 @@ using std::string;
 #ifndef HIDE_GENIE_MSG_LOG_MACROS
 
 #define LOG_FATAL(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::FATAL) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::FATAL << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ALERT(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::ALERT) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ALERT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_CRIT(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::CRIT) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::CRIT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ERROR(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::ERROR) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ERROR << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_WARN(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::WARN) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::WARN << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_NOTICE(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::NOTICE) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::NOTICE << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_INFO(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::INFO) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::INFO << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_DEBUG(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::DEBUG) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::DEBUG << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -159,46 +197,55 @@ using std::string;
 */
 
 #define LLOG(stream, priority) \
+           GMSG_IF_ENABLED(stream, priority) \
            (*Messenger::Instance())(stream) \
                << priority << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_FATAL(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::FATAL) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::FATAL << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ALERT(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::ALERT) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ALERT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_CRIT(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::CRIT) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::CRIT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ERROR(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::ERROR) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ERROR << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_WARN(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::WARN) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::WARN << "'[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_NOTICE(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::NOTICE) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::NOTICE << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_INFO(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::INFO) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::INFO << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_DEBUG(stream) \
+          GMSG_IF_ENABLED(stream, log4cpp::Priority::DEBUG) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::DEBUG << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -210,6 +257,7 @@ using std::string;
 */
 
 #define BLOG(stream, priority) \
+          GMSG_IF_ENABLED(stream, priority) \
           (*Messenger::Instance())(stream) << priority
 
 /*!
@@ -255,11 +303,26 @@ namespace genie {
 
 extern bool gAbortingInErr;
 
+//! Swallows a message streaming expression (see GMSG_IF_ENABLED)
+struct MessageSink {
+  template<class T> void operator & (const T &) const { }
+};
+
 class Messenger
 {
 public:
   static Messenger * Instance(void);
 
+  //! Would a message with the input priority be printed in the input stream?
+  //! Uses cached stream thresholds: No log4cpp call is made for streams
+  //! already looked up, until the priority levels are changed.
+  static bool IsEnabled (const char * stream, log4cpp::Priority::Value p);
+
+  //! Disable all messages from the calling thread. For helper threads (eg the
+  //! NtpWriter I/O thread): the cached stream thresholds and the log4cpp
+  //! appenders are not thread-safe, so only the main thread prints messages.
+  static void DisableForThread (void) { fThreadDisabled = true; }
+
   log4cpp::Category & operator () (const char * stream);
   void SetPriorityLevel(const char * stream, log4cpp::Priority::Value p);
 
@@ -276,6 +339,22 @@ private:
 
   log4cpp::Priority::Value PriorityFromString(string priority);
 
+  //! Cached priority threshold of a message stream
+  struct StreamThreshold {
+    const char * fStream;     ///< stream name, as passed by the caller
+    const char * fName;       ///< stream name, owned by the log4cpp category
+    int          fThreshold;  ///< the category chained priority
+    unsigned int fGeneration; ///< value of fGeneration when looked up
+  };
+
+  static void LookUpStream (const char * stream, StreamThreshold & entry);
+
+  static const unsigned int kNStreamThresholds = 1024;
+
+  static StreamThreshold fStreamThresholds[kNStreamThresholds]; ///< keyed by stream name address
+  static unsigned int    fGeneration; ///< incremented when priority levels change
+  static thread_local bool fThreadDisabled; ///< messages disabled in the calling thread?
+
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
@@ -288,5 +367,25 @@ private:
   friend struct Cleaner;
 };
 
+#if !defined(__CINT__) && !defined(__MAKECINT__)
+//____________________________________________________________________________
+inline bool Messenger::IsEnabled(
+   const char * stream, log4cpp::Priority::Value p)
+{
+  if(fThreadDisabled) return false;
+
+  unsigned long address = reinterpret_cast<unsigned long>(stream);
+  StreamThreshold & entry =
+     fStreamThresholds[ (address ^ (address >> 11)) % kNStreamThresholds ];
+
+  // the name is compared too, as the caller may pass a temporary buffer
+  if(entry.fStream != stream || entry.fGeneration != fGeneration ||
+     strcmp(entry.fName, stream) != 0) {
+    LookUpStream(stream, entry);
+  }
+  return p <= entry.fThreshold;
+}
+#endif
+
 }      // genie namespace
 #endif // _MESSENGER_H_
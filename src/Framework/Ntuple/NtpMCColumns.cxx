@@ -0,0 +1,305 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <TTree.h>
+#include <TLeaf.h>
+#include <TBits.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepFlags.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCColumns.h"
+
+using namespace genie;
+using namespace genie::constants;
+
+//____________________________________________________________________________
+NtpMCColumns::NtpMCColumns() :
+iev(0),
+n(0),
+wght(0),
+prob(0),
+xsec(0),
+dxsec(0),
+kps(0),
+flags(0),
+mask(0),
+interaction(0),
+fCapacity(0),
+fTree(0),
+fOwnInteraction(false),
+fEmptyInteraction(0)
+{
+  for(int k = 0; k < 4; k++) vtx[k] = 0;
+
+  this->AllocateArrays(256);
+}
+//____________________________________________________________________________
+NtpMCColumns::~NtpMCColumns()
+{
+  // when reading, the interaction object is allocated by ROOT
+  if(fOwnInteraction && interaction) delete interaction;
+  if(fEmptyInteraction) delete fEmptyInteraction;
+
+  this->DeleteArrays();
+}
+//____________________________________________________________________________
+void NtpMCColumns::CreateBranches(TTree * tree, int basket_size)
+{
+  fTree = tree;
+  fOwnInteraction = false;
+
+  tree->Branch("iev",    &iev,   "iev/i",   basket_size);
+  tree->Branch("n",      &n,     "n/I",     basket_size);
+  tree->Branch("wght",   &wght,  "wght/D",  basket_size);
+  tree->Branch("prob",   &prob,  "prob/D",  basket_size);
+  tree->Branch("xsec",   &xsec,  "xsec/D",  basket_size);
+  tree->Branch("dxsec",  &dxsec, "dxsec/D", basket_size);
+  tree->Branch("kps",    &kps,   "kps/I",   basket_size);
+  tree->Branch("vtx",    vtx,    "vtx[4]/D",basket_size);
+  tree->Branch("flags",  &flags, "flags/i", basket_size);
+  tree->Branch("mask",   &mask,  "mask/i",  basket_size);
+
+  tree->Branch("pdg",    pdg,    "pdg[n]/I",    basket_size);
+  tree->Branch("ist",    ist,    "ist[n]/I",    basket_size);
+  tree->Branch("rescat", rescat, "rescat[n]/I", basket_size);
+  tree->Branch("fm",     fm,     "fm[n]/I",     basket_size);
+  tree->Branch("lm",     lm,     "lm[n]/I",     basket_size);
+  tree->Branch("fd",     fd,     "fd[n]/I",     basket_size);
+  tree->Branch("ld",     ld,     "ld[n]/I",     basket_size);
+  tree->Branch("px",     px,     "px[n]/D",     basket_size);
+  tree->Branch("py",     py,     "py[n]/D",     basket_size);
+  tree->Branch("pz",     pz,     "pz[n]/D",     basket_size);
+  tree->Branch("e",      e,      "e[n]/D",      basket_size);
+  tree->Branch("x",      x,      "x[n]/D",      basket_size);
+  tree->Branch("y",      y,      "y[n]/D",      basket_size);
+  tree->Branch("z",      z,      "z[n]/D",      basket_size);
+  tree->Branch("t",      t,      "t[n]/D",      basket_size);
+  tree->Branch("polzth", polzth, "polzth[n]/D", basket_size);
+  tree->Branch("polzph", polzph, "polzph[n]/D", basket_size);
+  tree->Branch("erm",    erm,    "erm[n]/D",    basket_size);
+  tree->Branch("bound",  bound,  "bound[n]/O",  basket_size);
+
+  // not split (see NtpWriter::CreateGHEPEventBranch())
+  tree->Branch("interaction", "genie::Interaction", &interaction, basket_size, 0);
+}
+//____________________________________________________________________________
+void NtpMCColumns::SetBranchAddresses(TTree * tree)
+{
+  fTree = tree;
+  fOwnInteraction = true;
+
+  // make room for the largest event in the tree
+  TLeaf * nleaf = tree->GetLeaf("n");
+  if(nleaf) this->Reserve(nleaf->GetMaximum());
+
+  tree->SetBranchAddress("iev",   &iev  );
+  tree->SetBranchAddress("n",     &n    );
+  tree->SetBranchAddress("wght",  &wght );
+  tree->SetBranchAddress("prob",  &prob );
+  tree->SetBranchAddress("xsec",  &xsec );
+  tree->SetBranchAddress("dxsec", &dxsec);
+  tree->SetBranchAddress("kps",   &kps  );
+  tree->SetBranchAddress("vtx",   vtx   );
+  tree->SetBranchAddress("flags", &flags);
+  tree->SetBranchAddress("mask",  &mask );
+  tree->SetBranchAddress("interaction", &interaction);
+
+  this->SetAddresses();
+}
+//____________________________________________________________________________
+void NtpMCColumns::Fill(unsigned int ievent, const EventRecord * ev_rec)
+{
+  int np = ev_rec->GetEntries();
+  this->Reserve(np);
+
+  iev   = ievent;
+  n     = np;
+  wght  = ev_rec->Weight();
+  prob  = ev_rec->Probability();
+  xsec  = ev_rec->XSec();
+  dxsec = ev_rec->DiffXSec();
+  kps   = (int) ev_rec->DiffXSecVars();
+
+  const TLorentzVector * v = ev_rec->Vertex();
+  vtx[0] = v->X();
+  vtx[1] = v->Y();
+  vtx[2] = v->Z();
+  vtx[3] = v->T();
+
+  flags = 0;
+  mask  = 0;
+  for(unsigned int ib = 0; ib < GHepFlags::NFlags(); ib++) {
+    if(ev_rec->EventFlags()->TestBitNumber(ib)) flags |= (1u << ib);
+    if(ev_rec->EventMask ()->TestBitNumber(ib)) mask  |= (1u << ib);
+  }
+
+  interaction = ev_rec->Summary();
+  if(!interaction) {
+    if(!fEmptyInteraction) fEmptyInteraction = new Interaction;
+    interaction = fEmptyInteraction;
+  }
+
+  for(int i = 0; i < np; i++) {
+    const GHepParticle * p = ev_rec->Particle(i);
+    pdg   [i] = p->Pdg();
+    ist   [i] = (int) p->Status();
+    rescat[i] = p->RescatterCode();
+    fm    [i] = p->FirstMother();
+    lm    [i] = p->LastMother();
+    fd    [i] = p->FirstDaughter();
+    ld    [i] = p->LastDaughter();
+    px    [i] = p->Px();
+    py    [i] = p->Py();
+    pz    [i] = p->Pz();
+    e     [i] = p->E();
+    x     [i] = p->Vx();
+    y     [i] = p->Vy();
+    z     [i] = p->Vz();
+    t     [i] = p->Vt();
+    polzth[i] = p->PolzPolarAngle();
+    polzph[i] = p->PolzAzimuthAngle();
+    erm   [i] = p->RemovalEnergy();
+    bound [i] = p->IsBound();
+  }
+}
+//____________________________________________________________________________
+EventRecord * NtpMCColumns::ToEventRecord(void) const
+{
+  EventRecord * ev_rec = new EventRecord;
+
+  ev_rec->AttachSummary(
+     (interaction) ? new Interaction(*interaction) : new Interaction);
+  ev_rec->SetWeight      (wght);
+  ev_rec->SetProbability (prob);
+  ev_rec->SetXSec        (xsec);
+  ev_rec->SetDiffXSec    (dxsec, (KinePhaseSpace_t) kps);
+  ev_rec->SetVertex      (vtx[0], vtx[1], vtx[2], vtx[3]);
+
+  TBits evmask(GHepFlags::NFlags());
+  for(unsigned int ib = 0; ib < GHepFlags::NFlags(); ib++) {
+    ev_rec->EventFlags()->SetBitNumber(ib, (flags >> ib) & 1u);
+    evmask.SetBitNumber(ib, (mask >> ib) & 1u);
+  }
+  ev_rec->SetUnphysEventMask(evmask);
+
+  for(int i = 0; i < n; i++) {
+    GHepParticle p(pdg[i], (GHepStatus_t) ist[i], fm[i], lm[i], fd[i], ld[i],
+                   px[i], py[i], pz[i], e[i], x[i], y[i], z[i], t[i]);
+    p.SetRescatterCode(rescat[i]);
+    if(polzth[i] >= 0 && polzth[i] <= kPi && polzph[i] >= 0 && polzph[i] < 2*kPi) {
+      p.SetPolarization(polzth[i], polzph[i]);
+    }
+    if(bound[i]) {
+      p.SetBound(true);
+      p.SetRemovalEnergy(erm[i]);
+    }
+    ev_rec->AddParticle(p);
+  }
+
+  // the daughter lists were updated as particles were added: restore them
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = ev_rec->Particle(i);
+    p->SetFirstDaughter(fd[i]);
+    p->SetLastDaughter (ld[i]);
+  }
+  return ev_rec;
+}
+//____________________________________________________________________________
+void NtpMCColumns::Reserve(int np)
+{
+  if(np <= fCapacity) return;
+
+  LOG("Ntp", pINFO) << "Resizing the particle columns to: " << np;
+
+  // the arrays only hold the current event: no need to keep their contents
+  this->DeleteArrays();
+  this->AllocateArrays(np);
+
+  if(fTree) this->SetAddresses();
+}
+//____________________________________________________________________________
+void NtpMCColumns::AllocateArrays(int np)
+{
+  fCapacity = np;
+
+  pdg    = new Int_t    [np];
+  ist    = new Int_t    [np];
+  rescat = new Int_t    [np];
+  fm     = new Int_t    [np];
+  lm     = new Int_t    [np];
+  fd     = new Int_t    [np];
+  ld     = new Int_t    [np];
+  px     = new Double_t [np];
+  py     = new Double_t [np];
+  pz     = new Double_t [np];
+  e      = new Double_t [np];
+  x      = new Double_t [np];
+  y      = new Double_t [np];
+  z      = new Double_t [np];
+  t      = new Double_t [np];
+  polzth = new Double_t [np];
+  polzph = new Double_t [np];
+  erm    = new Double_t [np];
+  bound  = new Bool_t   [np];
+}
+//____________________________________________________________________________
+void NtpMCColumns::DeleteArrays(void)
+{
+  delete [] pdg;    pdg    = 0;
+  delete [] ist;    ist    = 0;
+  delete [] rescat; rescat = 0;
+  delete [] fm;     fm     = 0;
+  delete [] lm;     lm     = 0;
+  delete [] fd;     fd     = 0;
+  delete [] ld;     ld     = 0;
+  delete [] px;     px     = 0;
+  delete [] py;     py     = 0;
+  delete [] pz;     pz     = 0;
+  delete [] e;      e      = 0;
+  delete [] x;      x      = 0;
+  delete [] y;      y      = 0;
+  delete [] z;      z      = 0;
+  delete [] t;      t      = 0;
+  delete [] polzth; polzth = 0;
+  delete [] polzph; polzph = 0;
+  delete [] erm;    erm    = 0;
+  delete [] bound;  bound  = 0;
+
+  fCapacity = 0;
+}
+//____________________________________________________________________________
+void NtpMCColumns::SetAddresses(void)
+{
+// Points the particle array branches to the (re)allocated arrays
+
+  fTree->SetBranchAddress("pdg",    pdg   );
+  fTree->SetBranchAddress("ist",    ist   );
+  fTree->SetBranchAddress("rescat", rescat);
+  fTree->SetBranchAddress("fm",     fm    );
+  fTree->SetBranchAddress("lm",     lm    );
+  fTree->SetBranchAddress("fd",     fd    );
+  fTree->SetBranchAddress("ld",     ld    );
+  fTree->SetBranchAddress("px",     px    );
+  fTree->SetBranchAddress("py",     py    );
+  fTree->SetBranchAddress("pz",     pz    );
+  fTree->SetBranchAddress("e",      e     );
+  fTree->SetBranchAddress("x",      x     );
+  fTree->SetBranchAddress("y",      y     );
+  fTree->SetBranchAddress("z",      z     );
+  fTree->SetBranchAddress("t",      t     );
+  fTree->SetBranchAddress("polzth", polzth);
+  fTree->SetBranchAddress("polzph", polzph);
+  fTree->SetBranchAddress("erm",    erm   );
+  fTree->SetBranchAddress("bound",  bound );
+}
+//____________________________________________________________________________
@@ -0,0 +1,116 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCColumns
+
+\brief   Columnar (flat branch) representation of GENIE GHEP event records.
+
+         Each event-level quantity is a scalar branch and each particle
+         field is a variable-length array branch, counted by the per-event
+         number of particles (branch `n'). Analyses can therefore read only
+         the columns they need (e.g. pdg, ist and the 4-momenta) with no
+         object deserialization, and with any ROOT-based tool:
+
+           tree->SetBranchStatus("*",   0);
+           tree->SetBranchStatus("n",   1);
+           tree->SetBranchStatus("pdg", 1);
+           tree->SetBranchStatus("e",   1);
+
+         The attached Interaction summary is stored, as an object, in its own
+         (`interaction') branch so that the GHEP event record can be fully
+         restored (see ToEventRecord()) but it is not read unless enabled.
+
+\author  GENIE Collaboration
+
+\created October 15, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_COLUMNS_H_
+#define _NTP_MC_COLUMNS_H_
+
+#include <Rtypes.h>
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+class Interaction;
+
+class NtpMCColumns {
+
+public :
+  NtpMCColumns();
+ ~NtpMCColumns();
+
+  ///< create the output branches (basket size in bytes)
+  void CreateBranches (TTree * tree, int basket_size = 32000);
+
+  ///< set the addresses of the branches of an input tree
+  void SetBranchAddresses (TTree * tree);
+
+  ///< fill the columns from an event record
+  void Fill (unsigned int ievent, const EventRecord * ev_rec);
+
+  ///< build an event record from the columns (the caller takes ownership)
+  EventRecord * ToEventRecord (void) const;
+
+  ///< make room for events with up to np particles (clears the particle columns)
+  void Reserve (int np);
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+
+  // event
+  UInt_t   iev;        ///< event number
+  Int_t    n;          ///< number of particles
+  Double_t wght;       ///< event weight
+  Double_t prob;       ///< event probability
+  Double_t xsec;       ///< cross section for selected event
+  Double_t dxsec;      ///< differential cross section for selected event kinematics
+  Int_t    kps;        ///< phase space of the differential cross section (KinePhaseSpace_t)
+  Double_t vtx[4];     ///< vertex (x,y,z,t) in the detector coordinate system
+  UInt_t   flags;      ///< event flags (bit i = GHepFlags bit i)
+  UInt_t   mask;       ///< unphysical event mask
+  Interaction * interaction; ///< attached summary information
+
+  // particles (size n)
+  Int_t *    pdg;      ///< PDG code
+  Int_t *    ist;      ///< status code (GHepStatus_t)
+  Int_t *    rescat;   ///< rescattering code
+  Int_t *    fm;       ///< first mother index
+  Int_t *    lm;       ///< last mother index
+  Int_t *    fd;       ///< first daughter index
+  Int_t *    ld;       ///< last daughter index
+  Double_t * px;       ///< momentum x (GeV)
+  Double_t * py;       ///< momentum y (GeV)
+  Double_t * pz;       ///< momentum z (GeV)
+  Double_t * e;        ///< energy (GeV)
+  Double_t * x;        ///< position x (fm, in the nucleus coordinate system)
+  Double_t * y;        ///< position y (fm)
+  Double_t * z;        ///< position z (fm)
+  Double_t * t;        ///< position t
+  Double_t * polzth;   ///< polar polarization angle (rad)
+  Double_t * polzph;   ///< azimuthal polarization angle (rad)
+  Double_t * erm;      ///< removal energy (GeV)
+  Bool_t *   bound;    ///< is it a bound particle?
+
+private:
+
+  void AllocateArrays (int np);
+  void DeleteArrays   (void);
+  void SetAddresses   (void);
+
+  int           fCapacity;         ///< allocated size of the particle arrays
+  TTree *       fTree;             ///< the tree whose branches point to the columns
+  bool          fOwnInteraction;   ///< interaction allocated by ROOT when reading?
+  Interaction * fEmptyInteraction; ///< written for events with no attached summary
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_COLUMNS_H_
@@ -27,7 +27,8 @@ namespace genie {
 typedef enum ENtpMCFormat {
 
    kNFUndefined = -1,
-   kNFGHEP   /* each mc tree leaf contains the full GHEP EventRecord */
+   kNFGHEP,  /* each mc tree leaf contains the full GHEP EventRecord */
+   kNFGCOL   /* columnar GHEP: a flat branch per event / particle field */
 
 } NtpMCFormat_t;
 
@@ -41,6 +42,9 @@ class NtpMCFormat {
      case kNFGHEP:
               return "[NtpMCEventRecord]";
               break;
+     case kNFGCOL:
+              return "[NtpMCColumns]";
+              break;
      default:
               break;
      }
@@ -59,6 +63,9 @@ class NtpMCFormat {
      case kNFGHEP:
               return "ghep";
               break;
+     case kNFGCOL:
+              return "gcol";
+              break;
      default:
               break;
      }
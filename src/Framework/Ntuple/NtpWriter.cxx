@@ -10,16 +10,23 @@
 
 #include <cassert>
 #include <sstream>
+#include <vector>
+#include <utility>
 
+#include <pthread.h>
+
+#include <TROOT.h>
 #include <TFile.h>
 #include <TTree.h>
 #include <TClonesArray.h>
 #include <TFolder.h>
 
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCColumns.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCJobConfig.h"
 #include "Framework/Ntuple/NtpMCJobEnv.h"
@@ -28,9 +35,28 @@
 #include "RVersion.h"
 
 using std::ostringstream;
+using std::vector;
+using std::pair;
 
 using namespace genie;
 
+namespace genie {
+
+// Double-buffered event queue of the asynchronous mode
+struct NtpWriterQueue {
+  pthread_t       thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t  not_empty;  ///< signalled when events (or the end) are queued
+  pthread_cond_t  not_full;   ///< signalled when the I/O thread takes the queued events
+  unsigned int    capacity;   ///< max number of queued events
+  bool            done;       ///< no more events are coming
+  bool            idle;       ///< the I/O thread has written all events it took
+  vector< pair<int, EventRecord *> > pending; ///< filled by the generator thread
+  vector< pair<int, EventRecord *> > writing; ///< written by the I/O thread
+};
+
+}      // genie namespace
+
 //____________________________________________________________________________
 NtpWriter::NtpWriter(NtpMCFormat_t fmt, Long_t runnu) :
 fNtpFormat(fmt),
@@ -39,7 +65,15 @@ fOutFile(0),
 fOutTree(0),
 fEventBranch(0),
 fNtpMCEventRecord(0),
-fNtpMCTreeHeader(0)
+fNtpMCColumns(0),
+fCompression(-1),
+fBasketSize(32000),
+fAutoSave(200000000),  // autosave when 0.2 Gbyte written
+fAutoFlush(0),
+fNtpMCTreeHeader(0),
+fNOwnBranches(0),
+fQueueSize(RunOpt::Instance()->EventOutputQueueSize()),
+fQueue(0)
 {
   LOG("Ntp", pNOTICE) << "Run number: " << runnu;
   LOG("Ntp", pNOTICE)
@@ -50,7 +84,9 @@ fNtpMCTreeHeader(0)
 //____________________________________________________________________________
 NtpWriter::~NtpWriter()
 {
+  this->StopIOThread();
 
+  if(fNtpMCColumns) delete fNtpMCColumns;
 }
 //____________________________________________________________________________
 void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
@@ -66,6 +102,39 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
     return;
   }
 
+  if(fQueue || (fQueueSize > 0 && this->StartIOThread())) {
+    EventRecord * copy = EventRecordPool::Instance()->Get();
+    copy->Copy(*ev_rec);
+    this->QueueEventRecord(ievent, copy);
+    return;
+  }
+  this->WriteEventRecord(ievent, ev_rec);
+}
+//____________________________________________________________________________
+void NtpWriter::AdoptEventRecord(int ievent, EventRecord * ev_rec)
+{
+  LOG("Ntp", pINFO) << "Adding event " << ievent << " to output tree";
+
+  if(!ev_rec) {
+    LOG("Ntp", pERROR) << "NULL input EventRecord!";
+    return;
+  }
+  if(!fOutTree) {
+    LOG("Ntp", pERROR) << "No open output TTree to add the input EventRecord!";
+    EventRecordPool::Instance()->Release(ev_rec);
+    return;
+  }
+
+  if(fQueue || (fQueueSize > 0 && this->StartIOThread())) {
+    this->QueueEventRecord(ievent, ev_rec);
+    return;
+  }
+  this->WriteEventRecord(ievent, ev_rec);
+  EventRecordPool::Instance()->Release(ev_rec);
+}
+//____________________________________________________________________________
+void NtpWriter::WriteEventRecord(int ievent, const EventRecord * ev_rec)
+{
   switch (fNtpFormat) {
      case kNFGHEP:
           fNtpMCEventRecord = new NtpMCEventRecord();
@@ -74,11 +143,155 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
           delete fNtpMCEventRecord;
           fNtpMCEventRecord = 0;
           break;
+     case kNFGCOL:
+          fNtpMCColumns->Fill(ievent, ev_rec);
+          fOutTree->Fill();
+          break;
      default:
         break;
   }
 }
 //____________________________________________________________________________
+void NtpWriter::QueueEventRecord(int ievent, EventRecord * ev_rec)
+{
+  pthread_mutex_lock(&fQueue->mutex);
+
+  // back-pressure: wait for the I/O thread to take the queued events
+  while(fQueue->pending.size() >= fQueue->capacity) {
+    pthread_cond_wait(&fQueue->not_full, &fQueue->mutex);
+  }
+  fQueue->pending.push_back(pair<int, EventRecord *>(ievent, ev_rec));
+
+  pthread_cond_signal(&fQueue->not_empty);
+  pthread_mutex_unlock(&fQueue->mutex);
+}
+//____________________________________________________________________________
+bool NtpWriter::StartIOThread(void)
+{
+  // caller-defined branches are filled from caller-owned buffers
+  if(fOutTree->GetListOfBranches()->GetEntries() != fNOwnBranches) {
+    LOG("Ntp", pWARN)
+      << "The output tree has branches not created by the NtpWriter: "
+      << "Events will be written synchronously";
+    fQueueSize = 0;
+    return false;
+  }
+
+  LOG("Ntp", pNOTICE)
+    << "Writing events asynchronously (queue size: " << fQueueSize << ")";
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  // already enabled at start-up by the apps (see RunOpt): needed here when
+  // the asynchronous mode is requested through SetAsyncQueueSize()
+  ROOT::EnableThreadSafety();
+#endif
+
+  fQueue = new NtpWriterQueue;
+  fQueue->capacity = fQueueSize;
+  fQueue->done     = false;
+  fQueue->idle     = true;
+  fQueue->pending.reserve(fQueueSize);
+  fQueue->writing.reserve(fQueueSize);
+
+  pthread_mutex_init(&fQueue->mutex,     0);
+  pthread_cond_init (&fQueue->not_empty, 0);
+  pthread_cond_init (&fQueue->not_full,  0);
+
+  if(pthread_create(&fQueue->thread, 0, NtpWriter::IOThreadEntry, this) != 0) {
+    LOG("Ntp", pWARN)
+      << "Could not start the I/O thread: "
+      << "Events will be written synchronously";
+    pthread_mutex_destroy(&fQueue->mutex);
+    pthread_cond_destroy (&fQueue->not_empty);
+    pthread_cond_destroy (&fQueue->not_full);
+    delete fQueue;
+    fQueue = 0;
+    fQueueSize = 0;
+    return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+void NtpWriter::StopIOThread(void)
+{
+// Writes all queued events and stops the I/O thread
+
+  if(!fQueue) return;
+
+  pthread_mutex_lock(&fQueue->mutex);
+  fQueue->done = true;
+  pthread_cond_signal(&fQueue->not_empty);
+  pthread_mutex_unlock(&fQueue->mutex);
+
+  pthread_join(fQueue->thread, 0);
+
+  pthread_mutex_destroy(&fQueue->mutex);
+  pthread_cond_destroy (&fQueue->not_empty);
+  pthread_cond_destroy (&fQueue->not_full);
+  delete fQueue;
+  fQueue = 0;
+}
+//____________________________________________________________________________
+void NtpWriter::WaitForIOThread(void)
+{
+// Waits until all queued events are written
+
+  if(!fQueue) return;
+
+  pthread_mutex_lock(&fQueue->mutex);
+  while(!fQueue->pending.empty() || !fQueue->idle) {
+    pthread_cond_wait(&fQueue->not_full, &fQueue->mutex);
+  }
+  pthread_mutex_unlock(&fQueue->mutex);
+}
+//____________________________________________________________________________
+void * NtpWriter::IOThreadEntry(void * writer)
+{
+  static_cast<NtpWriter *>(writer)->RunIOThread();
+  return 0;
+}
+//____________________________________________________________________________
+void NtpWriter::RunIOThread(void)
+{
+  // no messages from this thread (see Messenger::DisableForThread)
+  Messenger::DisableForThread();
+
+  while(true) {
+    // take all queued events (swap the buffers) ...
+    pthread_mutex_lock(&fQueue->mutex);
+    while(fQueue->pending.empty() && !fQueue->done) {
+      pthread_cond_wait(&fQueue->not_empty, &fQueue->mutex);
+    }
+    if(fQueue->pending.empty()) {
+      pthread_mutex_unlock(&fQueue->mutex);
+      break;
+    }
+    fQueue->writing.swap(fQueue->pending);
+    fQueue->idle = false;
+    pthread_cond_broadcast(&fQueue->not_full);
+    pthread_mutex_unlock(&fQueue->mutex);
+
+    // ... and write them while the generator thread queues the next ones
+    for(unsigned int i = 0; i < fQueue->writing.size(); i++) {
+      this->WriteEventRecord(fQueue->writing[i].first, fQueue->writing[i].second);
+      EventRecordPool::Instance()->Release(fQueue->writing[i].second);
+    }
+    fQueue->writing.clear();
+
+    pthread_mutex_lock(&fQueue->mutex);
+    fQueue->idle = true;
+    pthread_cond_broadcast(&fQueue->not_full);
+    pthread_mutex_unlock(&fQueue->mutex);
+  }
+}
+//____________________________________________________________________________
+TTree * NtpWriter::EventTree(void)
+{
+  this->WaitForIOThread();
+
+  return fOutTree;
+}
+//____________________________________________________________________________
 void NtpWriter::Initialize()
 {
   LOG("Ntp",pINFO) << "Initializing GENIE output MC tree";
@@ -134,6 +347,36 @@ void NtpWriter::CustomizeFilenamePrefix (string prefix)
   this->SetDefaultFilename(prefix);
 }
 //____________________________________________________________________________
+void NtpWriter::SetCompressionSettings(int settings)
+{
+  fCompression = settings;
+}
+//____________________________________________________________________________
+void NtpWriter::SetBasketSize(int bytes)
+{
+  fBasketSize = bytes;
+}
+//____________________________________________________________________________
+void NtpWriter::SetAutoSave(Long64_t autos)
+{
+  fAutoSave = autos;
+}
+//____________________________________________________________________________
+void NtpWriter::SetAutoFlush(Long64_t autof)
+{
+  fAutoFlush = autof;
+}
+//____________________________________________________________________________
+void NtpWriter::SetAsyncQueueSize(int n)
+{
+  if(fQueue) {
+    LOG("Ntp", pWARN)
+      << "The I/O thread is already running: Can not change the queue size";
+    return;
+  }
+  fQueueSize = (n > 0) ? n : 0;
+}
+//____________________________________________________________________________
 void NtpWriter::SetDefaultFilename(string filename_prefix)
 {
   ostringstream fnstr;
@@ -155,6 +398,11 @@ void NtpWriter::OpenFile(string filename)
   // use "TFile::Open()" instead of "new TFile()" so that it can handle
   // alternative URLs (e.g. xrootd, etc)
   fOutFile = TFile::Open(filename.c_str(),"RECREATE");
+
+  if(fOutFile && fCompression >= 0) {
+    LOG("Ntp", pINFO) << "Compression settings: " << fCompression;
+    fOutFile->SetCompressionSettings(fCompression);
+  }
 }
 //____________________________________________________________________________
 void NtpWriter::CreateTree(void)
@@ -168,7 +416,8 @@ void NtpWriter::CreateTree(void)
               << ", Format: " << NtpMCFormat::AsString(fNtpFormat);
 
   fOutTree = new TTree("gtree",title.str().c_str());
-  fOutTree->SetAutoSave(200000000);  // autosave when 0.2 Gbyte written
+  fOutTree->SetAutoSave(fAutoSave);
+  if(fAutoFlush != 0) fOutTree->SetAutoFlush(fAutoFlush);
 }
 //____________________________________________________________________________
 void NtpWriter::CreateEventBranch(void)
@@ -177,6 +426,9 @@ void NtpWriter::CreateEventBranch(void)
      case kNFGHEP:
         this->CreateGHEPEventBranch();
         break;
+     case kNFGCOL:
+        this->CreateGCOLEventBranch();
+        break;
      default:
         LOG("Ntp", pERROR)
            << "Unknown TTree format. Can not create TBranches";
@@ -184,6 +436,8 @@ void NtpWriter::CreateEventBranch(void)
   }
   assert(fEventBranch);
   fEventBranch->SetAutoDelete(kFALSE);
+
+  fNOwnBranches = fOutTree->GetListOfBranches()->GetEntries();
 }
 //____________________________________________________________________________
 void NtpWriter::CreateGHEPEventBranch(void)
@@ -200,12 +454,24 @@ void NtpWriter::CreateGHEPEventBranch(void)
 #endif
 
   fEventBranch = fOutTree->Branch("gmcrec",
-      "genie::NtpMCEventRecord", &fNtpMCEventRecord, 32000, split);
+      "genie::NtpMCEventRecord", &fNtpMCEventRecord, fBasketSize, split);
   // was split=1 ... but, at least w/ ROOT 6.06/04, this generates
   //   Warning in <TTree::Bronch>: genie::NtpMCEventRecord cannot be split, resetting splitlevel to 0
   // which the art framework turns into a fatal error
 }
 //____________________________________________________________________________
+void NtpWriter::CreateGCOLEventBranch(void)
+{
+  LOG("Ntp", pINFO) << "Creating the NtpMCColumns TBranches";
+
+  if(fNtpMCColumns) delete fNtpMCColumns;
+  fNtpMCColumns = new NtpMCColumns;
+  fNtpMCColumns->CreateBranches(fOutTree, fBasketSize);
+
+  // the particle count, read with any other column
+  fEventBranch = fOutTree->GetBranch("n");
+}
+//____________________________________________________________________________
 void NtpWriter::CreateTreeHeader(void)
 {
   LOG("Ntp", pINFO) << "Creating the NtpMCTreeHeader";
@@ -224,6 +490,8 @@ void NtpWriter::Save(void)
 {
   LOG("Ntp", pINFO) << "Saving the output tree";
 
+  this->StopIOThread();
+
   if(fOutFile) {
 
     fOutFile->Write();
@@ -6,6 +6,28 @@
 \brief   A utility class to facilitate creating the GENIE MC Ntuple from the
          output GENIE GHEP event records.
 
+         Events are written either as NtpMCEventRecord objects (kNFGHEP) or
+         in columns (kNFGCOL, see NtpMCColumns). The compression settings,
+         basket size and auto-save / auto-flush thresholds can be tuned
+         before Initialize().
+
+         In asynchronous mode (SetAsyncQueueSize(n), n>0, or the common
+         --event-output-queue option) events are handed over to a dedicated
+         I/O thread which fills the tree, so that basket compression and
+         flushing overlap with event generation. Events are queued in a
+         double buffer: the generator thread appends to one buffer while the
+         I/O thread writes the other. Once n events are waiting, the generator
+         thread blocks until the I/O thread takes them (back-pressure), so up
+         to 2n events are held in memory. Events are written in the order they
+         were added and the output is identical to the synchronous mode.
+         Use AdoptEventRecord() to hand events over without copying them.
+         Branches added to EventTree() by the caller are read when the tree
+         is filled, so the writer stays synchronous if any such branch exists
+         (eg the flux branches of gevgen_t2k and gevgen_fnal). No messages are
+         printed from the I/O thread. Programs requesting the asynchronous
+         mode through SetAsyncQueueSize() should call ROOT::EnableThreadSafety()
+         before creating any ROOT object (RunOpt does so for the apps).
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -34,7 +56,9 @@ namespace genie {
 
 class EventRecord;
 class NtpMCEventRecord;
+class NtpMCColumns;
 class NtpMCTreeHeader;
+struct NtpWriterQueue;
 
 class NtpWriter {
 
@@ -48,17 +72,33 @@ public :
   ///< add event
   void AddEventRecord (int ievent, const EventRecord * ev_rec);
 
+  ///< add event and take ownership of it (no copy is made in asynchronous mode;
+  ///< once written, the event is released to the EventRecordPool)
+  void AdoptEventRecord (int ievent, EventRecord * ev_rec);
+
   ///< save the event tree
   void Save (void);
 
-  ///< get the even tree
-  TTree *  EventTree (void) { return fOutTree; }
+  ///< get the even tree (waits until all queued events are written)
+  TTree *  EventTree (void);
 
   ///< use before Initialize() only if you wish to override the default
   ///< filename, or the default filename prefix
   void CustomizeFilename       (string filename);
   void CustomizeFilenamePrefix (string prefix);
 
+  ///< use before Initialize() only if you wish to override the default
+  ///< compression (ROOT settings: 100 x algorithm + level), basket size (bytes)
+  ///< or auto-save / auto-flush thresholds (>0: bytes, <0: entries, see TTree)
+  void SetCompressionSettings  (int settings);
+  void SetBasketSize           (int bytes);
+  void SetAutoSave             (Long64_t autos);
+  void SetAutoFlush            (Long64_t autof);
+
+  ///< use before adding events to override the default (RunOpt) output queue
+  ///< size: 0 for synchronous output, n>0 to write events asynchronously
+  void SetAsyncQueueSize       (int n);
+
 private:
 
   void SetDefaultFilename    (string filename_prefix="gntp");
@@ -67,6 +107,15 @@ private:
   void CreateTreeHeader      (void);
   void CreateEventBranch     (void);
   void CreateGHEPEventBranch (void);
+  void CreateGCOLEventBranch (void);
+  void WriteEventRecord      (int ievent, const EventRecord * ev_rec);
+  void QueueEventRecord      (int ievent, EventRecord * ev_rec);
+  bool StartIOThread         (void);
+  void StopIOThread          (void);
+  void WaitForIOThread       (void);
+  void RunIOThread           (void);
+
+  static void * IOThreadEntry (void * writer);
 
   NtpMCFormat_t      fNtpFormat;          ///< enumeration of event formats
   Long_t             fRunNu;              ///< run nu
@@ -75,7 +124,15 @@ private:
   TTree *            fOutTree;            ///< output tree
   TBranch *          fEventBranch;        ///< the generated event branch
   NtpMCEventRecord * fNtpMCEventRecord;   ///<
+  NtpMCColumns *     fNtpMCColumns;       ///< columns (for kNFGCOL)
+  int                fCompression;        ///< compression settings (<0: ROOT default)
+  int                fBasketSize;         ///< event branch basket size
+  Long64_t           fAutoSave;           ///< tree auto-save threshold
+  Long64_t           fAutoFlush;          ///< tree auto-flush threshold (0: ROOT default)
   NtpMCTreeHeader *  fNtpMCTreeHeader;    ///<
+  int                fNOwnBranches;       ///< number of branches created by the writer
+  int                fQueueSize;          ///< output queue size (0: synchronous output)
+  NtpWriterQueue *   fQueue;              //! output queue & I/O thread (asynchronous mode)
 };
 
 }      // genie namespace
@@ -96,6 +96,9 @@ double BLI2DUnifGrid::Evaluate(double x, double y) const
 
   int ix_lo  = TMath::FloorNint( (x - fXmin) / fDX );
   int iy_lo  = TMath::FloorNint( (y - fYmin) / fDY );
+  // in case x = xmax or y = ymax
+  ix_lo = TMath::Min(ix_lo, fNX-2);
+  iy_lo = TMath::Min(iy_lo, fNY-2);
   int ix_hi  = ix_lo + 1;
   int iy_hi  = iy_lo + 1;
 
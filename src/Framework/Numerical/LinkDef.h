@@ -9,6 +9,8 @@
 #pragma link C++ namespace genie::utils::gsl;
 
 #pragma link C++ class genie::RandomGen;
+#pragma link C++ class genie::PhiloxRandom;
+#pragma link C++ class genie::NBodyPhaseSpace;
 #pragma link C++ class genie::Spline;
 #pragma link C++ class genie::BLI2DGrid;
 #pragma link C++ class genie::BLI2DUnifGrid;
@@ -0,0 +1,178 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
+
+using namespace genie;
+
+// weight table binning & safety factors: the weight distribution has a
+// longer tail with more daughters, so the maximum of a sample of decays
+// underestimates the true maximum more often for n >= 4 (see the violation
+// rates reported by gtestNBodyPhaseSpace)
+static const int    kNWeightMaxThrows = 2000;           // decays per bin edge
+static const double kKineBinT0        = 1.*units::MeV;  // first bin edge
+static const double kKineBinRatio     = 1.1;            // ratio of consecutive edges
+static const double kWeightMaxSafety3 = 1.2;            // 3-body decays
+static const double kWeightMaxSafetyN = 1.5;            // 4- or more body decays
+
+// warm-up estimate of the maximum weight, for decays to more than
+// NBodyPhaseSpace::kMaxTabulatedN daughters (as used before the tables)
+static const int    kNWarmUpThrows    = 200;            // decays per estimate
+static const double kWeightMaxWarmUp  = 2.3;            // safety factor
+
+//____________________________________________________________________________
+NBodyPhaseSpace * NBodyPhaseSpace::fInstance = 0;
+const int NBodyPhaseSpace::kMaxTabulatedN;
+//____________________________________________________________________________
+NBodyPhaseSpace::NBodyPhaseSpace()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+NBodyPhaseSpace::~NBodyPhaseSpace()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+NBodyPhaseSpace * NBodyPhaseSpace::Instance()
+{
+  if(fInstance == 0) {
+    static NBodyPhaseSpace::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+
+    fInstance = new NBodyPhaseSpace;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::WeightMax(double M, int n, const double * mass)
+{
+  // the weight of 2-body decays is always 1
+  if(n <= 2) return 1.;
+
+  if(n > kMaxTabulatedN) {
+    return TMath::Min(1.,
+       kWeightMaxWarmUp * this->WarmUpWeightMax(M, n, mass));
+  }
+
+  double safety = (n == 3) ? kWeightMaxSafety3 : kWeightMaxSafetyN;
+
+  return TMath::Min(1., safety * this->SampledWeightMax(M, n, mass));
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::SampledWeightMax(double M, int n, const double * mass)
+{
+  if(n <= 2) return 1.;
+  if(n > kMaxTabulatedN) return this->WarmUpWeightMax(M, n, mass);
+
+  vector<double> masses(mass, mass+n);
+  double sum = 0;
+  for(int i = 0; i < n; i++) sum += mass[i];
+
+  int ib = this->KineBin(M - sum);
+  return TMath::Max(
+     this->EdgeWeightMax(masses, ib), this->EdgeWeightMax(masses, ib+1));
+}
+//____________________________________________________________________________
+void NBodyPhaseSpace::RaiseWeightMax(
+                           double M, int n, const double * mass, double w)
+{
+  // nothing to raise without a table
+  if(n <= 2 || n > kMaxTabulatedN) return;
+
+  vector<double> masses(mass, mass+n);
+  double sum = 0;
+  for(int i = 0; i < n; i++) sum += mass[i];
+
+  int ib = this->KineBin(M - sum);
+  for(int ie = ib; ie <= ib+1; ie++) {
+    double & wmax = this->EdgeWeightMax(masses, ie);
+    wmax = TMath::Max(wmax, w);
+  }
+}
+//____________________________________________________________________________
+void NBodyPhaseSpace::Reset(void)
+{
+  fWMax.clear();
+}
+//____________________________________________________________________________
+void NBodyPhaseSpace::SortMasses(
+              int n, const double * mass, double * sorted, int * index)
+{
+  vector<int> order(n);
+  TMath::Sort(n, mass, &order[0], false);
+
+  for(int k = 0; k < n; k++) {
+    sorted[k]       = mass[order[k]];
+    index[order[k]] = k;
+  }
+}
+//____________________________________________________________________________
+int NBodyPhaseSpace::KineBin(double T) const
+{
+// Bins of the available kinetic energy T. Bin i spans the edges i, i+1.
+// Decays with T below the first edge use the first bin.
+
+  if(T <= kKineBinT0) return 0;
+  return TMath::FloorNint(TMath::Log(T/kKineBinT0) / TMath::Log(kKineBinRatio));
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::KineBinEdge(int ie) const
+{
+  return kKineBinT0 * TMath::Power(kKineBinRatio, ie);
+}
+//____________________________________________________________________________
+double & NBodyPhaseSpace::EdgeWeightMax(const vector<double> & masses, int ie)
+{
+  map<int,double> & table = fWMax[masses];
+
+  map<int,double>::iterator it = table.find(ie);
+  if(it != table.end()) return it->second;
+
+  int    n   = masses.size();
+  double sum = 0;
+  for(int i = 0; i < n; i++) sum += masses[i];
+
+  TLorentzVector p4(0., 0., 0., sum + this->KineBinEdge(ie));
+
+  // no estimate if TGenPhaseSpace can not handle the decay: use the bound
+  double wmax = 1.;
+  if(fGenerator.SetDecay(p4, n, &masses[0])) {
+    wmax = 0.;
+    for(int i = 0; i < kNWeightMaxThrows; i++) {
+      wmax = TMath::Max(wmax, fGenerator.Generate());
+    }
+  }
+
+  LOG("NBodyPS", pDEBUG)
+    << "Max weight for " << n << "-body decays @ M = " << p4.M()
+    << ": " << wmax;
+
+  return (table[ie] = wmax);
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::WarmUpWeightMax(double M, int n, const double * mass)
+{
+// Largest weight in a (small) sample of decays at M, not cached
+
+  TLorentzVector p4(0., 0., 0., M);
+
+  // no estimate if TGenPhaseSpace can not handle the decay: use the bound
+  if(!fGenerator.SetDecay(p4, n, mass)) return 1.;
+
+  double wmax = 0.;
+  for(int i = 0; i < kNWarmUpThrows; i++) {
+    wmax = TMath::Max(wmax, fGenerator.Generate());
+  }
+  return wmax;
+}
+//____________________________________________________________________________
@@ -0,0 +1,113 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NBodyPhaseSpace
+
+\brief   A singleton serving the maximum weight of TGenPhaseSpace n-body
+         decays, for the unweighted (accept/reject) phase space decays of
+         the hadronization, resonance decay and MEC modules.
+
+         The TGenPhaseSpace weight depends only on the invariant mass M of
+         the decaying system and on the daughter masses, and it never
+         exceeds 1. The maximum weight is therefore tabulated, on first use,
+         for each set of daughter masses in bins of the available kinetic
+         energy T = M - sum(m_i), with bin edges logarithmically spaced.
+         Each edge holds the largest weight in a sample of decays at that T,
+         and the maximum weight in a bin is the larger of its two edge
+         values, times a safety factor (larger for 4- or more body decays),
+         capped at 1. Callers can raise a bin if a decay weight ever exceeds
+         its value.
+
+         The weight distribution depends on the order of the daughters, so
+         the tables are keyed on the ordered mass set. Callers should set
+         up their decays with the masses in the canonical order returned by
+         SortMasses(), so that all permutations of a final state share one
+         table.
+
+         This replaces the per-decay estimate of the maximum weight from a
+         sample of warm-up decays, for up to kMaxTabulatedN daughters (the
+         multiplicities validated with gtestNBodyPhaseSpace). Decays with
+         more daughters keep the warm-up estimate. Two-body decays have a
+         weight of exactly 1 and are accepted directly, without a table.
+
+\author  GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NBODY_PHASE_SPACE_H_
+#define _NBODY_PHASE_SPACE_H_
+
+#include <map>
+#include <vector>
+
+#include <TGenPhaseSpace.h>
+
+using std::map;
+using std::vector;
+
+namespace genie {
+
+class NBodyPhaseSpace {
+
+public:
+
+  static NBodyPhaseSpace * Instance (void);
+
+  //! Largest multiplicity with tabulated maximum weights
+  static const int kMaxTabulatedN = 8;
+
+  //! Sort the n input masses in the canonical (increasing) order. On
+  //! output, index[i] is the position of the i-th input mass in 'sorted'
+  static void SortMasses (int n, const double * mass, double * sorted, int * index);
+
+  //! Maximum TGenPhaseSpace weight for the decay of a system with invariant
+  //! mass M to n particles with the input masses
+  double WeightMax      (double M, int n, const double * mass);
+
+  //! Largest weight found in the decay samples at the edges of the bin of M,
+  //! without the safety factor: the normalization of weighted decays
+  double SampledWeightMax (double M, int n, const double * mass);
+
+  //! Raise the maximum weight at M, after a decay weight w > WeightMax()
+  void   RaiseWeightMax (double M, int n, const double * mass, double w);
+
+  //! Clear the tables
+  void   Reset          (void);
+
+private:
+
+  NBodyPhaseSpace();
+  NBodyPhaseSpace(const NBodyPhaseSpace & ps);
+  virtual ~NBodyPhaseSpace();
+
+  int      KineBin       (double T) const;
+  double   KineBinEdge   (int ib)   const;
+  double & EdgeWeightMax (const vector<double> & masses, int ie);
+  double   WarmUpWeightMax (double M, int n, const double * mass);
+
+  static NBodyPhaseSpace * fInstance;
+
+  map<vector<double>, map<int,double> > fWMax; ///< max weight at the T bin edges, per daughter mass set
+  TGenPhaseSpace fGenerator;                   ///< generator used to fill the tables
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (NBodyPhaseSpace::fInstance !=0) {
+            delete NBodyPhaseSpace::fInstance;
+            NBodyPhaseSpace::fInstance = 0;
+         }
+      }
+  };
+
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _NBODY_PHASE_SPACE_H_
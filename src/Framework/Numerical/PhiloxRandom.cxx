@@ -0,0 +1,170 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/PhiloxRandom.h"
+
+using namespace genie;
+
+ClassImp(PhiloxRandom)
+
+// Philox4x32 round multipliers and Weyl sequence key increments
+static const unsigned long long kPhiloxM0 = 0xD2511F53ULL;
+static const unsigned long long kPhiloxM1 = 0xCD9E8D57ULL;
+static const unsigned int       kPhiloxW0 = 0x9E3779B9U;
+static const unsigned int       kPhiloxW1 = 0xBB67AE85U;
+static const int                kPhiloxNRounds = 10;
+
+// 2^-32: converts a 32-bit word to a double in [0,1) (as done by TRandom3)
+static const double kPhiloxWordToDouble = 2.3283064365386963e-10;
+
+//____________________________________________________________________________
+PhiloxRandom::PhiloxRandom() :
+TRandom3()
+{
+  this->SetKey(0);
+  this->SetStream(0);
+  this->SetEvent(0);
+}
+//____________________________________________________________________________
+PhiloxRandom::PhiloxRandom(unsigned int stream_id, long int seed) :
+TRandom3()
+{
+  this->SetKey(seed);
+  this->SetStream(stream_id);
+  this->SetEvent(0);
+}
+//____________________________________________________________________________
+PhiloxRandom::~PhiloxRandom()
+{
+
+}
+//____________________________________________________________________________
+void PhiloxRandom::Philox4x32(unsigned int ctr[4], const unsigned int key[2])
+{
+  unsigned int k0 = key[0];
+  unsigned int k1 = key[1];
+
+  for(int iround = 0; iround < kPhiloxNRounds; iround++) {
+    unsigned long long p0 = kPhiloxM0 * ctr[0];
+    unsigned long long p1 = kPhiloxM1 * ctr[2];
+    unsigned int hi0 = (unsigned int) (p0 >> 32);
+    unsigned int lo0 = (unsigned int) (p0);
+    unsigned int hi1 = (unsigned int) (p1 >> 32);
+    unsigned int lo1 = (unsigned int) (p1);
+
+    ctr[0] = hi1 ^ ctr[1] ^ k0;
+    ctr[1] = lo1;
+    ctr[2] = hi0 ^ ctr[3] ^ k1;
+    ctr[3] = lo0;
+
+    k0 += kPhiloxW0;
+    k1 += kPhiloxW1;
+  }
+}
+//____________________________________________________________________________
+void PhiloxRandom::SetKey(long int seed)
+{
+  unsigned long long useed = (unsigned long long) seed;
+  fKey[0] = (unsigned int) (useed);
+  fKey[1] = (unsigned int) (useed >> 32);
+
+  fNUsed = 4; // discard the current block
+}
+//____________________________________________________________________________
+void PhiloxRandom::SetEvent(long int ievent)
+{
+  unsigned long long uevent = (unsigned long long) ievent;
+  fCounter[0] = (unsigned int) (uevent);
+  fCounter[1] = (unsigned int) (uevent >> 32);
+  fCounter[3] = 0;
+
+  fNUsed = 4;
+}
+//____________________________________________________________________________
+void PhiloxRandom::SetStream(unsigned int stream_id)
+{
+  fCounter[2] = stream_id;
+  fCounter[3] = 0;
+
+  fNUsed = 4;
+}
+//____________________________________________________________________________
+long int PhiloxRandom::Event(void) const
+{
+  unsigned long long uevent =
+     ((unsigned long long) fCounter[1] << 32) | fCounter[0];
+  return (long int) uevent;
+}
+//____________________________________________________________________________
+void PhiloxRandom::NextBlock(void)
+{
+  fBlock[0] = fCounter[0];
+  fBlock[1] = fCounter[1];
+  fBlock[2] = fCounter[2];
+  fBlock[3] = fCounter[3];
+
+  Philox4x32(fBlock, fKey);
+
+  fCounter[3]++; // 2^32 blocks (2^34 numbers) per event and stream
+  fNUsed = 0;
+}
+//____________________________________________________________________________
+Double_t PhiloxRandom::Rndm(void)
+{
+// Returns a uniform random number in (0,1]. As in TRandom3, 0 is skipped.
+
+  while(1) {
+    if(fNUsed >= 4) this->NextBlock();
+    unsigned int word = fBlock[fNUsed++];
+    if(word) return kPhiloxWordToDouble * word;
+  }
+  return 0;
+}
+//____________________________________________________________________________
+void PhiloxRandom::RndmArray(Int_t n, Double_t * array)
+{
+// Fills the input array with n uniform random numbers in (0,1].
+// Whole blocks are generated directly into a local buffer, so that the loop
+// over the (independent) Philox evaluations can be vectorized.
+
+  Int_t i = 0;
+
+  // use up what is left from the current block
+  while(i < n && fNUsed < 4) array[i++] = this->Rndm();
+
+  const Int_t kNBlocksPerBatch = 16;
+  unsigned int buffer[4*kNBlocksPerBatch];
+
+  while(n - i >= 4) {
+    Int_t nblocks = (n - i) / 4;
+    if(nblocks > kNBlocksPerBatch) nblocks = kNBlocksPerBatch;
+
+    for(Int_t ib = 0; ib < nblocks; ib++) {
+      unsigned int * block = buffer + 4*ib;
+      block[0] = fCounter[0];
+      block[1] = fCounter[1];
+      block[2] = fCounter[2];
+      block[3] = fCounter[3] + ib;
+      Philox4x32(block, fKey);
+    }
+    fCounter[3] += nblocks;
+
+    for(Int_t iw = 0; iw < 4*nblocks; iw++) {
+      unsigned int word = buffer[iw];
+      array[i++] = (word) ? kPhiloxWordToDouble * word : this->Rndm();
+    }
+  }
+
+  // generate the remainder
+  while(i < n) array[i++] = this->Rndm();
+}
+//____________________________________________________________________________
+void PhiloxRandom::RndmArray(Int_t n, Float_t * array)
+{
+  for(Int_t i = 0; i < n; i++) array[i] = (Float_t) this->Rndm();
+}
+//____________________________________________________________________________
@@ -0,0 +1,75 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::PhiloxRandom
+
+\brief    A counter-based random number stream (Philox4x32-10, see J.K.Salmon
+          et al., "Parallel random numbers: as easy as 1, 2, 3", SC11).
+
+          Each random number is a pure function of a key and a counter: the
+          key is derived from the run seed and the counter is made of the
+          (event index, stream id, block index) triplet. Independent streams
+          need no shared state and any event can be regenerated directly by
+          setting its index, without replaying the preceding events.
+
+          The class derives from TRandom3 so that it can be handed out by the
+          RandomGen TRandom3& accessors: all TRandom distributions (Gaus, Exp,
+          Poisson, ...) are built on the overriden Rndm(). The Mersenne Twister
+          state inherited from TRandom3 is not used.
+
+\author   GENIE Collaboration
+
+\created  October 15, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _PHILOX_RANDOM_H_
+#define _PHILOX_RANDOM_H_
+
+#include <TRandom3.h>
+
+namespace genie {
+
+class PhiloxRandom : public TRandom3 {
+
+public:
+  using TRandom3::Rndm;
+
+  PhiloxRandom();
+  PhiloxRandom(unsigned int stream_id, long int seed = 0);
+  virtual ~PhiloxRandom();
+
+  // Generate uniform random numbers in (0,1]
+  virtual Double_t Rndm      (void);
+  virtual void     RndmArray (Int_t n, Float_t  * array);
+  virtual void     RndmArray (Int_t n, Double_t * array);
+
+  // Set the key (run seed) and the position in the stream
+  void SetKey    (long int seed);
+  void SetEvent  (long int ievent);
+  void SetStream (unsigned int stream_id);
+
+  long int     Event  (void) const;
+  unsigned int Stream (void) const { return fCounter[2]; }
+
+  //! The Philox4x32-10 bijection: encrypts ctr[4] in place using key[2]
+  static void Philox4x32 (unsigned int ctr[4], const unsigned int key[2]);
+
+private:
+
+  void NextBlock (void);
+
+  unsigned int fKey     [2]; ///< key, derived from the run seed
+  unsigned int fCounter [4]; ///< (event index low, event index high, stream id, block)
+  unsigned int fBlock   [4]; ///< current block of random 32-bit words
+  unsigned int fNUsed;       ///< number of words of the current block already used
+
+ClassDef(PhiloxRandom,1)
+};
+
+}      // genie namespace
+
+#endif // _PHILOX_RANDOM_H_
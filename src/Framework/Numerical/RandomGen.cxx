@@ -16,6 +16,7 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/PhiloxRandom.h"
 
 using namespace genie::controls;
 
@@ -30,6 +31,8 @@ RandomGen::RandomGen()
 
   fInitalized = false;
   fInstance = 0;
+  fRunSeed = 0;
+  fUseCounterStreams = false;
 /*
   // try to get this job's random number seed from the environment
   const char * seed = gSystem->Getenv("GSEED");
@@ -65,6 +68,9 @@ RandomGen::RandomGen()
 RandomGen::~RandomGen()
 {
   fInstance = 0;
+  for(int is = 0; is < kNRndStreams; is++) {
+    if(fCounterRnd[is]) delete fCounterRnd[is];
+  }
   if(fRandom3) delete fRandom3;
 }
 //____________________________________________________________________________
@@ -88,25 +94,25 @@ void RandomGen::SetSeed(long int seed)
      << ((fInitalized) ? ": " : " at random number generator initialization: ")
      << seed;
 
-  // Set the seed number for all internal GENIE random number generators
-  this->RndKine ().SetSeed(seed);
-  this->RndHadro().SetSeed(seed);
-  this->RndDec  ().SetSeed(seed);
-  this->RndFsi  ().SetSeed(seed);
-  this->RndLep  ().SetSeed(seed);
-  this->RndISel ().SetSeed(seed);
-  this->RndGeom ().SetSeed(seed);
-  this->RndFlux ().SetSeed(seed);
-  this->RndEvg  ().SetSeed(seed);
-  this->RndNum  ().SetSeed(seed);
-  this->RndGen  ().SetSeed(seed);
+  fRunSeed = seed;
+  this->ReseedGenerators(seed);
 
-  // Set the seed number for ROOT's gRandom
-  gRandom ->SetSeed (seed);
+  if(fUseCounterStreams) {
+    for(int is = 0; is < kNRndStreams; is++) {
+      fCounterRnd[is]->SetKey  (seed);
+      fCounterRnd[is]->SetEvent(0);
+    }
+  }
 
-  // Set the PYTHIA6 seed number
   TPythia6 * pythia6 = TPythia6::Instance();
-  pythia6->SetMRPY(1, seed);
+
+  if(fUseCounterStreams) {
+    LOG("Rndm", pINFO)
+      << "Using counter-based streams keyed by the run seed = " << seed;
+    LOG("Rndm", pINFO) << "gRandom  seed = " << gRandom->GetSeed();
+    LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6->GetMRPY(1);
+    return;
+  }
 
   LOG("Rndm", pINFO) << "RndKine  seed = " << this->RndKine ().GetSeed();
   LOG("Rndm", pINFO) << "RndHadro seed = " << this->RndHadro().GetSeed();
@@ -123,9 +129,93 @@ void RandomGen::SetSeed(long int seed)
   LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6->GetMRPY(1);
 }
 //____________________________________________________________________________
+void RandomGen::SetEventSeed(long int ievent)
+{
+// Re-seeds all generators for the event with the input index. The run seed
+// is left untouched so that the method can be called for every event.
+// In the counter-based mode the GENIE streams are simply moved to the input
+// event; only the external generators (gRandom, PYTHIA6) are re-seeded.
+
+  long int seed = this->EventSeed(ievent);
+
+  LOG("Rndm", pINFO)
+     << "Setting random number seed for event " << ievent << ": " << seed;
+
+  this->ReseedGenerators(seed);
+
+  if(fUseCounterStreams) {
+    for(int is = 0; is < kNRndStreams; is++) {
+      fCounterRnd[is]->SetEvent(ievent);
+    }
+  }
+}
+//____________________________________________________________________________
+long int RandomGen::EventSeed(long int ievent) const
+{
+// Derives an event seed from the (run seed, event index) pair using the
+// splitmix64 finalizer, so that the seeds of consecutive events are not
+// correlated. The result is folded into a positive 31-bit number as the
+// PYTHIA6 MRPY(1) seed must be in [0, 900000000).
+
+  unsigned long long z = (unsigned long long) fRunSeed;
+  z ^= 0x9E3779B97F4A7C15ULL * ((unsigned long long) ievent + 1);
+  z  = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z  = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z  =  z ^ (z >> 31);
+
+  long int seed = (long int) (z % 900000000ULL);
+  if(seed == 0) seed = kDefaultRandSeed; // TRandom3 treats 0 as 'random seed'
+  return seed;
+}
+//____________________________________________________________________________
+void RandomGen::ReseedGenerators(long int seed)
+{
+  fCurrSeed = seed;
+
+  // Set the seed number for all internal GENIE random number generators
+  // (the counter-based streams are keyed by the run seed, see SetSeed)
+  fRandom3->SetSeed(seed);
+
+  // Set the seed number for ROOT's gRandom
+  gRandom ->SetSeed (seed);
+
+  // Set the PYTHIA6 seed number (MRPY(2)=0 forces PYTHIA6 to re-initialize
+  // its generator from MRPY(1) at the next call)
+  TPythia6 * pythia6 = TPythia6::Instance();
+  pythia6->SetMRPY(1, seed);
+  pythia6->SetMRPY(2, 0);
+}
+//____________________________________________________________________________
+void RandomGen::UseCounterBasedStreams(bool on)
+{
+// Switches the GENIE streams to independent counter-based generators (or
+// back to the shared Mersenne Twister). The counter-based streams are keyed
+// by the current run seed and positioned at event 0.
+
+  LOG("Rndm", pNOTICE)
+     << ((on) ? "Using" : "Not using") << " counter-based random number streams";
+
+  fUseCounterStreams = on;
+
+  for(int is = 0; is < kNRndStreams; is++) {
+    if(on) {
+      if(!fCounterRnd[is]) fCounterRnd[is] = new PhiloxRandom(is);
+      fCounterRnd[is]->SetKey  (fRunSeed);
+      fCounterRnd[is]->SetEvent(0);
+      fStream[is] = fCounterRnd[is];
+    } else {
+      fStream[is] = fRandom3;
+    }
+  }
+}
+//____________________________________________________________________________
 void RandomGen::InitRandomGenerators(long int seed)
 {
   fRandom3 = new TRandom3();
+  for(int is = 0; is < kNRndStreams; is++) {
+    fCounterRnd[is] = 0;
+    fStream    [is] = fRandom3;
+  }
   this->SetSeed(seed);
 }
 //____________________________________________________________________________
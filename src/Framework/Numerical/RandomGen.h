@@ -9,6 +9,11 @@
           to all GENIE modules and that all modules use the preferred rndm
           number generator.
 
+          By default all accessors return the same Mersenne Twister. In the
+          counter-based mode (see UseCounterBasedStreams()) each accessor
+          returns its own PhiloxRandom stream, keyed by the run seed and
+          positioned at the current event index (see SetEventSeed()).
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -26,10 +31,28 @@
 
 namespace genie {
 
+class PhiloxRandom;
+
 class RandomGen {
 
 public:
 
+  //! Ids of the random number streams used by the various GENIE modules
+  typedef enum ERndStream {
+    kRndKine = 0,
+    kRndHadro,
+    kRndDec,
+    kRndFsi,
+    kRndLep,
+    kRndISel,
+    kRndGeom,
+    kRndFlux,
+    kRndEvg,
+    kRndNum,
+    kRndGen,
+    kNRndStreams
+  } RndStream_t;
+
   //! Access instance
   static RandomGen * Instance();
 
@@ -47,41 +70,56 @@ public:
   //! See: http://root.cern.ch/root/html/TRandom3.html
 
   //! rnd number generator used by kinematics generators
-  TRandom3 & RndKine (void) const { return *fRandom3; }
+  TRandom3 & RndKine (void) const { return *fStream[kRndKine]; }
 
   //! rnd number generator used by hadronization models
-  TRandom3 & RndHadro (void) const { return *fRandom3; }
+  TRandom3 & RndHadro (void) const { return *fStream[kRndHadro]; }
 
   //! rnd number generator used by decay models
-  TRandom3 & RndDec (void) const { return *fRandom3; }
+  TRandom3 & RndDec (void) const { return *fStream[kRndDec]; }
 
   //! rnd number generator used by intranuclear cascade monte carlos
-  TRandom3 & RndFsi (void) const { return *fRandom3; }
+  TRandom3 & RndFsi (void) const { return *fStream[kRndFsi]; }
 
   //! rnd number generator used by final state primary lepton generators
-  TRandom3 & RndLep (void) const { return *fRandom3; }
+  TRandom3 & RndLep (void) const { return *fStream[kRndLep]; }
 
   //! rnd number generator used by interaction selectors
-  TRandom3 & RndISel (void) const { return *fRandom3; }
+  TRandom3 & RndISel (void) const { return *fStream[kRndISel]; }
 
   //! rnd number generator used by geometry drivers
-  TRandom3 & RndGeom (void) const { return *fRandom3; }
+  TRandom3 & RndGeom (void) const { return *fStream[kRndGeom]; }
 
   //! rnd number generator used by flux drivers
-  TRandom3 & RndFlux (void) const { return *fRandom3; }
+  TRandom3 & RndFlux (void) const { return *fStream[kRndFlux]; }
 
   //! rnd number generator used by the event generation drivers
-  TRandom3 & RndEvg (void) const { return *fRandom3; }
+  TRandom3 & RndEvg (void) const { return *fStream[kRndEvg]; }
 
   //! rnd number generator used by MC integrators & other numerical methods
-  TRandom3 & RndNum (void) const { return *fRandom3; }
+  TRandom3 & RndNum (void) const { return *fStream[kRndNum]; }
 
   //! rnd number generator for generic usage
-  TRandom3 & RndGen  (void) const { return *fRandom3; }
+  TRandom3 & RndGen  (void) const { return *fStream[kRndGen]; }
 
   long int GetSeed (void)         const { return fCurrSeed; }
   void     SetSeed (long int seed);
 
+  //! Re-seed all generators with a seed derived from the run seed (the one
+  //! passed to SetSeed) and the input event index. Any given event can then
+  //! be regenerated, in any process, without replaying the preceding events.
+  void     SetEventSeed (long int ievent);
+  long int EventSeed    (long int ievent) const;
+  long int GetRunSeed   (void)            const { return fRunSeed; }
+
+  //! Switch between the default mode (a single Mersenne Twister for all
+  //! streams) and the counter-based mode, where each stream is an independent
+  //! PhiloxRandom generator keyed by (run seed, event index, stream id).
+  //! In that mode SetEventSeed() just moves all streams to the input event
+  //! and draws made by one module do not shift the sequences of the others.
+  void UseCounterBasedStreams  (bool on = true);
+  bool UsesCounterBasedStreams (void) const { return fUseCounterStreams; }
+
 private:
 
   RandomGen();
@@ -90,11 +128,16 @@ private:
 
   static RandomGen * fInstance;
 
-  TRandom3 * fRandom3;    ///< Mersenne Twistor
-  long int   fCurrSeed;   ///< random number generator seed number
-  bool       fInitalized; ///< done initializing singleton?
+  TRandom3 *     fRandom3;                  ///< Mersenne Twistor
+  PhiloxRandom * fCounterRnd[kNRndStreams]; ///< counter-based streams
+  TRandom3 *     fStream[kNRndStreams];     ///< generator used by each stream
+  bool           fUseCounterStreams;        ///< using the counter-based streams?
+  long int       fCurrSeed;                 ///< random number generator seed number
+  long int       fRunSeed;                  ///< run seed (seed last set via SetSeed)
+  bool           fInitalized;               ///< done initializing singleton?
 
   void InitRandomGenerators(long int seed);
+  void ReseedGenerators    (long int seed);
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
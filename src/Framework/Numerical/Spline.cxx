@@ -360,42 +360,21 @@ bool Spline::IsWithinValidRange(double x) const
 //___________________________________________________________________________
 double Spline::Evaluate(double x) const
 {
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Spline", pDEBUG) << "Evaluating spline at point x = " << x;
+#endif
   assert(!TMath::IsNaN(x));
 
   double y = 0;
   if( this->IsWithinValidRange(x) ) {
-
     // we can interpolate within the range of spline knots - be careful with
     // strange cubic spline behaviour when close to knots with y=0
-    bool is0p = this->ClosestKnotValueIsZero(x, "+");
-    bool is0n = this->ClosestKnotValueIsZero(x, "-");
-
-    if(!is0p && !is0n) {
-      // both knots (on the left and right are non-zero) - just interpolate
-      LOG("Spline", pDEBUG) << "Point is between non-zero knots";
-      y = fInterpolator->Eval(x);
-    } else {
-      // at least one of the neighboring knots has y=0
-      if(is0p && is0n) {
-        // both neighboring knots have y=0
-        LOG("Spline", pDEBUG) << "Point is between zero knots";
-        y=0;
-      } else {
-        // just 1 neighboring knot has y=0 - do a linear interpolation
-        LOG("Spline", pDEBUG)
-          << "Point has zero" << (is0n ? " left " : " right ") << "knot";
-        double xpknot=0, ypknot=0, xnknot=0, ynknot=0;
-        this->FindClosestKnot(x, xnknot, ynknot, "-");
-        this->FindClosestKnot(x, xpknot, ypknot, "+");
-        if(is0n) y = ypknot * (x-xnknot)/(xpknot-xnknot);
-        else     y = ynknot * (x-xnknot)/(xpknot-xnknot);
-      }
-    }
-
+    y = this->EvaluateInterval(this->FindKnot(x), x);
   } else {
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("Spline", pDEBUG) << "x = " << x
      << " is not within spline range [" << fXMin << ", " << fXMax << "]";
+#endif
   }
 
   if(y<0 && !fYCanBeNegative) {
@@ -404,11 +383,161 @@ double Spline::Evaluate(double x) const
     LOG("Spline", pINFO) << "spline range [" << fXMin << ", " << fXMax << "]";
   }
 
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Spline", pDEBUG) << "Spline(x = " << x << ") = " << y;
+#endif
 
   return y;
 }
 //___________________________________________________________________________
+void Spline::Evaluate(int n, const double * x, double * y) const
+{
+// Evaluates the spline at the n input points, y[i] = Evaluate(x[i]).
+// The points are processed in chunks: The knot intervals are looked-up first
+// and the cubic polynomials are then evaluated in a branch-free loop that the
+// compiler can vectorize. Points outside the spline range, or next to knots
+// with y=0, are patched up afterwards.
+
+  const int kChunk = 64;
+  int iknot[kChunk];
+
+  for(int i0 = 0; i0 < n; i0 += kChunk) {
+    int m = TMath::Min(kChunk, n - i0);
+    const double * xc = x + i0;
+    double *       yc = y + i0;
+
+    for(int i = 0; i < m; i++) {
+      assert(!TMath::IsNaN(xc[i]));
+      iknot[i] = (this->IsWithinValidRange(xc[i])) ? this->FindKnot(xc[i]) : -1;
+    }
+
+    const double * kx = &fKnotX[0];
+    const double * ky = &fKnotY[0];
+    const double * kb = &fKnotB[0];
+    const double * kc = &fKnotC[0];
+    const double * kd = &fKnotD[0];
+    for(int i = 0; i < m; i++) {
+      int    k  = (iknot[i] < 0) ? 0 : iknot[i];
+      double dx = xc[i] - kx[k];
+      yc[i] = ky[k] + dx*(kb[k] + dx*(kc[k] + dx*kd[k]));
+    }
+
+    for(int i = 0; i < m; i++) {
+      int k = iknot[i];
+      if(k < 0) {
+        yc[i] = 0;
+      }
+      else if(fNKnots < 2 || fKnotIsZero[k] || fKnotIsZero[k+1]) {
+        yc[i] = this->EvaluateInterval(k, xc[i]);
+      }
+      if(yc[i]<0 && !fYCanBeNegative) {
+        LOG("Spline", pINFO) << "Negative y (" << yc[i] << ")";
+        LOG("Spline", pINFO) << "x = " << xc[i];
+        LOG("Spline", pINFO)
+          << "spline range [" << fXMin << ", " << fXMax << "]";
+      }
+    }
+  }
+}
+//___________________________________________________________________________
+double Spline::Max(double xmin, double xmax) const
+{
+// Returns the maximum of the spline, as evaluated by Evaluate(), over the
+// input range: The largest of its values at the range edges, at the knots
+// within the range and at the stationary points of the cubic polynomials.
+// The spline is 0 outside its valid range.
+
+  double ymax = (xmin < fXMin || xmax > fXMax) ? 0. : -DBL_MAX;
+
+  double a = TMath::Max(xmin, fXMin);
+  double b = TMath::Min(xmax, fXMax);
+  if(a > b) return 0.;
+
+  if(fNKnots < 2) return TMath::Max(ymax, fKnotY[0]);
+
+  int k0 = this->FindKnot(a);
+  int k1 = this->FindKnot(b);
+  for(int k = k0; k <= k1; k++) {
+    double lo = TMath::Max(a, fKnotX[k]);
+    double hi = TMath::Min(b, fKnotX[k+1]);
+    ymax = TMath::Max(ymax, this->EvaluateInterval(k, lo));
+    ymax = TMath::Max(ymax, this->EvaluateInterval(k, hi));
+
+    // linear or null interpolation next to knots with y=0
+    if(fKnotIsZero[k] || fKnotIsZero[k+1]) continue;
+
+    // y' = B + 2C dx + 3D dx^2 = 0
+    double B = fKnotB[k];
+    double C = fKnotC[k];
+    double D = fKnotD[k];
+    double dx[2];
+    int    nroots = 0;
+    if(D == 0.) {
+      if(C != 0.) dx[nroots++] = -B/(2*C);
+    } else {
+      double disc = C*C - 3*B*D;
+      if(disc >= 0.) {
+        double sq = TMath::Sqrt(disc);
+        dx[nroots++] = (-C + sq)/(3*D);
+        dx[nroots++] = (-C - sq)/(3*D);
+      }
+    }
+    for(int ir = 0; ir < nroots; ir++) {
+      double x = fKnotX[k] + dx[ir];
+      if(x > lo && x < hi) {
+        ymax = TMath::Max(ymax, this->EvaluateInterval(k, x));
+      }
+    }
+  }
+  return ymax;
+}
+//___________________________________________________________________________
+int Spline::FindKnot(double x) const
+{
+// Returns the index i of the knot interval [x_i, x_i+1] used for evaluating
+// the spline at x (x must be within the spline range). Same as TSpline3,
+// i is the last knot with x_i < x (or 0), capped to the last interval.
+// The lookup table gives a starting point which is corrected by a (short)
+// walk, so the result does not depend on the knot spacing.
+
+  int nknots = fNKnots;
+  if(nknots < 2) return 0;
+
+  int ncells = fCellKnot.size();
+  double u = (fCellsInLog) ? TMath::Log(x) : x;
+  int icell = (int) ((u - fCellMin) * fCellInvWidth);
+  if(icell < 0)       icell = 0;
+  if(icell >= ncells) icell = ncells-1;
+
+  int k = fCellKnot[icell];
+  while(k < nknots-2 && fKnotX[k+1] <  x) k++;
+  while(k > 0        && fKnotX[k]   >= x) k--;
+  return k;
+}
+//___________________________________________________________________________
+double Spline::EvaluateInterval(int k, double x) const
+{
+  if(fNKnots < 2) return fKnotY[0];
+
+  bool is0n = fKnotIsZero[k];
+  bool is0p = fKnotIsZero[k+1];
+
+  if(!is0p && !is0n) {
+    // both knots (on the left and right are non-zero) - just interpolate
+    double dx = x - fKnotX[k];
+    return fKnotY[k] + dx*(fKnotB[k] + dx*(fKnotC[k] + dx*fKnotD[k]));
+  }
+  if(is0p && is0n) {
+    // both neighboring knots have y=0
+    return 0;
+  }
+  // just 1 neighboring knot has y=0 - do a linear interpolation
+  double xnknot = fKnotX[k];
+  double xpknot = fKnotX[k+1];
+  if(is0n) return fKnotY[k+1] * (x-xnknot)/(xpknot-xnknot);
+  else     return fKnotY[k]   * (x-xnknot)/(xpknot-xnknot);
+}
+//___________________________________________________________________________
 void Spline::SaveAsXml(
                 string filename, string xtag, string ytag, string name) const
 {
@@ -559,6 +688,28 @@ bool Spline::ClosestKnotValueIsZero(double x, Option_t * opt) const
   return false;
 }
 //___________________________________________________________________________
+double Spline::EvaluateIfLowerKnotNonZero(double x) const
+{
+// Returns 0 if the knot at or below x (as found by TSpline3::FindX) has y=0,
+// otherwise the spline value at x. Uses the knot interval of the flat spline
+// arrays and the precomputed y=0 flags of the knots.
+
+  assert(!TMath::IsNaN(x));
+  if(!this->IsWithinValidRange(x)) return 0;
+
+  int k = this->FindKnot(x);
+  int klow = (k+1 < fNKnots && fKnotX[k+1] <= x) ? k+1 : k;
+  if(fKnotIsZero[klow]) return 0;
+
+  double y = this->EvaluateInterval(k, x);
+  if(y<0 && !fYCanBeNegative) {
+    LOG("Spline", pINFO) << "Negative y (" << y << ")";
+    LOG("Spline", pINFO) << "x = " << x;
+    LOG("Spline", pINFO) << "spline range [" << fXMin << ", " << fXMax << "]";
+  }
+  return y;
+}
+//___________________________________________________________________________
 void Spline::Print(ostream & stream) const
 {
   int    nknots = this->NKnots();
@@ -726,6 +877,17 @@ void Spline::InitSpline(void)
 
   fYCanBeNegative = false;
 
+  fKnotX.clear();
+  fKnotY.clear();
+  fKnotB.clear();
+  fKnotC.clear();
+  fKnotD.clear();
+  fKnotIsZero.clear();
+  fCellKnot.clear();
+  fCellsInLog   = false;
+  fCellMin      = 0.0;
+  fCellInvWidth = 0.0;
+
   LOG("Spline", pDEBUG) << "...done initializing spline";
 }
 //___________________________________________________________________________
@@ -751,6 +913,53 @@ void Spline::BuildSpline(int nentries, double x[], double y[])
 
   fInterpolator = new TSpline3("spl3", x, y, nentries, "0");
 
+  // copy the knots and the polynomial coefficients into flat arrays
+  fKnotX.resize(nentries);
+  fKnotY.resize(nentries);
+  fKnotB.resize(nentries);
+  fKnotC.resize(nentries);
+  fKnotD.resize(nentries);
+  fKnotIsZero.resize(nentries);
+  for(int i = 0; i < nentries; i++) {
+    fInterpolator->GetCoeff(i, fKnotX[i], fKnotY[i],
+                               fKnotB[i], fKnotC[i], fKnotD[i]);
+    // same as utils::math::AreEqual(y,0), without the printout
+    fKnotIsZero[i] = (TMath::Abs(fKnotY[i]) < 0.001*DBL_EPSILON);
+  }
+  this->BuildLookupTable();
+
   LOG("Spline", pDEBUG) << "...done building spline";
 }
 //___________________________________________________________________________
+void Spline::BuildLookupTable(void)
+{
+// Splits the spline range in 2 x (number of knot intervals) cells, uniform
+// in log(x) if possible, and stores the knot interval at the lower edge of
+// each cell
+
+  fCellKnot.clear();
+
+  int nknots = fNKnots;
+  if(nknots < 2) return;
+
+  fCellsInLog = (fXMin > 0);
+
+  double umin = (fCellsInLog) ? TMath::Log(fXMin) : fXMin;
+  double umax = (fCellsInLog) ? TMath::Log(fXMax) : fXMax;
+
+  int ncells = 2*(nknots-1);
+  double width = (umax-umin)/ncells;
+
+  fCellMin      = umin;
+  fCellInvWidth = (width > 0) ? 1./width : 0.;
+
+  fCellKnot.resize(ncells);
+  int k = 0;
+  for(int icell = 0; icell < ncells; icell++) {
+    double u = umin + icell*width;
+    double xedge = (fCellsInLog) ? TMath::Exp(u) : u;
+    while(k < nknots-2 && fKnotX[k+1] < xedge) k++;
+    fCellKnot[icell] = k;
+  }
+}
+//___________________________________________________________________________
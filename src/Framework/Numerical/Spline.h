@@ -5,9 +5,14 @@
 
 \brief    A numeric analysis tool class for interpolating 1-D functions.
 
-          Uses ROOT's TSpline3 for the actual interpolation and can retrieve
-          function (x,y(x)) pairs from an XML file, a flat ascii file, a
-          TNtuple, a TTree or an SQL database.
+          Uses ROOT's TSpline3 for building the interpolating polynomials and
+          can retrieve function (x,y(x)) pairs from an XML file, a flat ascii
+          file, a TNtuple, a TTree or an SQL database.
+          Evaluation does not go through the TSpline3: the knots and the
+          polynomial coefficients are copied into flat arrays, and the knot
+          interval is found via a lookup table of cells that are uniform in
+          log(x) (or x), so for the usual log-spaced cross section splines it
+          is found in O(1). The results are identical to those of TSpline3.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -25,6 +30,7 @@
 #include <string>
 #include <fstream>
 #include <ostream>
+#include <vector>
 
 #include <TObject.h>
 #include <TSpline.h>
@@ -37,6 +43,7 @@ class TGraph;
 using std::string;
 using std::ostream;
 using std::ofstream;
+using std::vector;
 
 namespace genie {
 
@@ -77,6 +84,8 @@ public:
   double XMax               (void) const {return fXMax;  }
   double YMax               (void) const {return fYMax;  }
   double Evaluate           (double x) const;
+  void   Evaluate           (int n, const double * x, double * y) const;
+  double Max                (double xmin, double xmax) const;
   bool   IsWithinValidRange (double x) const;
 
   void   SetName (string name) { fName = name; }
@@ -98,6 +107,9 @@ public:
   // Knot manipulation methods in additions to the TSpline3 ones
   void FindClosestKnot(double x, double & xknot, double & yknot, Option_t * opt="-+") const;
   bool ClosestKnotValueIsZero(double x, Option_t * opt="-+") const;
+  //! Same as ClosestKnotValueIsZero(x,"-") ? 0 : Evaluate(x), with a single
+  //! knot interval search
+  double EvaluateIfLowerKnotNonZero(double x) const;
 
   // Common mathematical operations applied simultaneously on all spline knots
   void Add      (const Spline & spl, double c=1);
@@ -119,6 +131,11 @@ private:
   void InitSpline  (void);
   void ResetSpline (void);
   void BuildSpline (int nentries, double x[], double y[]);
+  void BuildLookupTable (void);
+
+  // Flat spline evaluation
+  int    FindKnot         (double x) const;
+  double EvaluateInterval (int iknot, double x) const;
 
   // Private data members
   string     fName;
@@ -129,6 +146,20 @@ private:
   TSpline3 * fInterpolator;
   bool       fYCanBeNegative;
 
+  // Flat copy of the knots and of the TSpline3 polynomial coefficients
+  // y = fKnotY[i] + dx*(fKnotB[i] + dx*(fKnotC[i] + dx*fKnotD[i])),
+  // dx = x - fKnotX[i], and of the knot interval lookup table
+  vector<double> fKnotX;          //!
+  vector<double> fKnotY;          //!
+  vector<double> fKnotB;          //!
+  vector<double> fKnotC;          //!
+  vector<double> fKnotD;          //!
+  vector<char>   fKnotIsZero;     //! y=0 at knot?
+  vector<int>    fCellKnot;       //! last knot below the lower edge of each cell
+  bool           fCellsInLog;     //! lookup table cells uniform in log(x)?
+  double         fCellMin;        //! lower edge of the first cell, x or log(x)
+  double         fCellInvWidth;   //! inverse cell width
+
 ClassDef(Spline,1)
 };
 
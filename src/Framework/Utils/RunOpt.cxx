@@ -13,6 +13,8 @@
 
 #include <TMath.h>
 #include <TBits.h>
+#include <TROOT.h>
+#include <RVersion.h>
 
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Utils/CmdLnArgParser.h"
@@ -76,6 +78,8 @@ void RunOpt::Init(void)
   fEventRecordPrintLevel  = 3;
   fEventGeneratorList     = "Default";
   fXMLPath = "";
+  fEventOutputQueueSize   = 0;
+  fRecycleEventRecords    = false;
 }
 //____________________________________________________________________________
 void RunOpt::SetTuneName(string tuneName)
@@ -129,6 +133,20 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
     SetEventGeneratorList(parser.ArgAsString("event-generator-list"));
   }
 
+  if( parser.OptionExists("event-output-queue") ) {
+    fEventOutputQueueSize = TMath::Max(
+        0, parser.ArgAsInt("event-output-queue"));
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+    // events are written from a separate thread (see NtpWriter): ROOT has to
+    // be made thread-safe before any ROOT object is created
+    if(fEventOutputQueueSize > 0) ROOT::EnableThreadSafety();
+#endif
+  }
+
+  if( parser.OptionExists("recycle-event-records") ) {
+    fRecycleEventRecords = true;
+  }
+
   if (parser.OptionExists("xml-path")) {
     fXMLPath = parser.ArgAsString("xml-path");
   }
@@ -165,6 +183,10 @@ void RunOpt::Print(ostream & stream) const
          << GHepFlags::NFlags()-1 << " -> 0) : " << *fUnphysEventMask;
   stream << "\n Event record print level : " << fEventRecordPrintLevel;
   stream << "\n MC job status file refresh rate: " << fMCJobStatusRefreshRate;
+  stream << "\n Event output queue size (0: synchronous output) : "
+         << fEventOutputQueueSize;
+  stream << "\n Recycle event records? : "
+         << ((fRecycleEventRecords) ? "Yes" : "No");
   stream << "\n Pre-calculate all free-nucleon cross-sections? : "
          << ((fEnableBareXSecPreCalc) ? "Yes" : "No");
 
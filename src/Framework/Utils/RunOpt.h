@@ -49,6 +49,8 @@ public:
   int    EventRecordPrintLevel  (void) const { return fEventRecordPrintLevel;  }
   int    MCJobStatusRefreshRate (void) const { return fMCJobStatusRefreshRate; }
   bool   BareXSecPreCalc        (void) const { return fEnableBareXSecPreCalc;  }
+  int    EventOutputQueueSize   (void) const { return fEventOutputQueueSize;   }
+  bool   RecycleEventRecords    (void) const { return fRecycleEventRecords;    }
   string XMLPath                (void) const { return fXMLPath;  }
 
   // If a user accesses the GENIE objects directly, then most of the options above
@@ -78,6 +80,9 @@ private:
   bool   fEnableBareXSecPreCalc;     ///< Cache calcs relevant to free-nucleon xsecs before any nuclear xsec computation?
                                      ///< The option switches on/off cacheing calculations which interfere with event reweighting.
   string fXMLPath;                   ///< An path to look for XML in. Higher priority than GXMLPATH
+  int    fEventOutputQueueSize;      ///< Number of events queued for asynchronous output (0: synchronous output).
+                                     ///< Ignored (synchronous output) if the app adds its own branches to the output tree, as gevgen_t2k and gevgen_fnal do.
+  bool   fRecycleEventRecords;       ///< Recycle event records (see EventRecordPool)?
 
   // Self
   static RunOpt * fInstance;
@@ -9,8 +9,13 @@
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <dirent.h>
 #include <ctime>
@@ -154,3 +159,55 @@ string genie::utils::system::LocalTimeAsString(string format)
   return local_time_as_string;
 }
 //___________________________________________________________________________
+int genie::utils::system::ForkWorkers(int nworkers, vector<int> & pids)
+{
+  pids.clear();
+  if(nworkers <= 1) return 0;
+
+  // flush pending output so that it is not replicated in the workers
+  std::cout.flush();
+  std::cerr.flush();
+
+  for(int iw = 1; iw < nworkers; iw++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("System", pFATAL)
+        << "Could not fork worker process " << iw << ": " << strerror(errno);
+      genie::gAbortingInErr = true;
+      exit(1);
+    }
+    if(pid == 0) {
+      // worker process
+      pids.clear();
+      LOG("System", pNOTICE)
+        << "Started worker " << iw << "/" << nworkers
+        << " (pid: " << getpid() << ")";
+      return iw;
+    }
+    pids.push_back(pid);
+  }
+  return 0;
+}
+//___________________________________________________________________________
+bool genie::utils::system::WaitForWorkers(const vector<int> & pids)
+{
+  bool ok = true;
+  for(unsigned int iw = 0; iw < pids.size(); iw++) {
+    int status = 0;
+    pid_t pid = pids[iw];
+    if(waitpid(pid, &status, 0) != pid) {
+      LOG("System", pERROR)
+        << "Failed waiting for worker " << iw+1 << " (pid: " << pid << ")";
+      ok = false;
+      continue;
+    }
+    bool exited_ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if(!exited_ok) {
+      LOG("System", pERROR)
+        << "Worker " << iw+1 << " (pid: " << pid << ") did not finish cleanly";
+      ok = false;
+    }
+  }
+  return ok;
+}
+//___________________________________________________________________________
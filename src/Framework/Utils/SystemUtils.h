@@ -41,6 +41,14 @@ namespace system
 
   string LocalTimeAsString(string format);
 
+  //! Forks nworkers-1 worker processes and returns the worker index in each
+  //! process: 0 in the calling process (which receives the worker pids),
+  //! 1...nworkers-1 in the workers.
+  int  ForkWorkers    (int nworkers, vector<int> & pids);
+  //! Waits for the input worker processes to finish.
+  //! Returns true if all of them exited normally.
+  bool WaitForWorkers (const vector<int> & pids);
+
 } // system namespace
 } // utils  namespace
 } // genie  namespace
@@ -13,6 +13,12 @@
 
 #include <fstream>
 #include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -32,10 +38,43 @@
 #include "Framework/Utils/XmlParserUtils.h"
 
 using std::ofstream;
+using std::ifstream;
 using std::endl;
 
 namespace genie {
 
+//____________________________________________________________________________
+// Binary spline file layout (native byte order, checked via fByteOrder):
+// - header
+// - spline table: one entry per spline
+// - string table: tune names and spline keys (not null-terminated)
+// - knot data, 8-byte aligned: E[nknots] followed by xsec[nknots] per spline
+//
+namespace {
+  const char     kBinSplMagic[8]   = { 'G','X','S','P','L','B','I','N' };
+  const uint32_t kBinSplByteOrder  = 0x01020304;
+  const uint32_t kBinSplVersion    = 1;
+
+  struct BinSplHeader_t {
+    char     fMagic[8];
+    uint32_t fByteOrder;
+    uint32_t fVersion;
+    uint32_t fUseLogE;
+    uint32_t fNSplines;
+    uint64_t fStringsOffset;
+    uint64_t fKnotsOffset;
+  };
+  struct BinSplEntry_t {
+    uint64_t fTuneOffset;   // in string table
+    uint64_t fKeyOffset;    // in string table
+    uint32_t fTuneLength;
+    uint32_t fKeyLength;
+    uint64_t fKnotsOffset;  // in bytes, from the start of the file
+    uint32_t fNKnots;
+    uint32_t fReserved;
+  };
+}
+
 //____________________________________________________________________________
 ostream & operator << (ostream & stream, const XSecSplineList & list)
 {
@@ -53,12 +92,21 @@ XSecSplineList::XSecSplineList()
   fNKnots      = 100;
   fEmin        =   0.01; // GeV
   fEmax        = 100.00; // GeV
+  fNWorkers    =   1;
+  fWorkerId    =   0;
+  fGeneration  =   0;
 }
 //____________________________________________________________________________
 XSecSplineList::~XSecSplineList()
 {
 // Clean up.
 
+  this->ClearSplines();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+void XSecSplineList::ClearSplines(void)
+{
   map<string,  map<string, Spline *> >::iterator mm_iter = fSplineMap.begin();
   for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
     // loop over splines for given tune
@@ -72,7 +120,16 @@ XSecSplineList::~XSecSplineList()
     spl_map_curr_tune.clear();
   }
   fSplineMap.clear();
-  fInstance = 0;
+  fBinarySplineMap.clear();
+  fSplineHandles.clear();
+  fSplineHandleMap.clear();
+  fGeneration++;
+
+  for(unsigned int i = 0; i < fMappedFiles.size(); i++) {
+    munmap(fMappedFiles[i], fMappedFileSizes[i]);
+  }
+  fMappedFiles.clear();
+  fMappedFileSizes.clear();
 }
 //____________________________________________________________________________
 XSecSplineList * XSecSplineList::Instance()
@@ -105,13 +162,16 @@ bool XSecSplineList::SplineExists(string key) const
 
   map<string,  map<string, Spline *> >::const_iterator //
   mm_iter = fSplineMap.find(fCurrentTune);
-  if(mm_iter == fSplineMap.end()) {
+  map<string,  map<string, BinarySpline> >::const_iterator //
+  bm_iter = fBinarySplineMap.find(fCurrentTune);
+  if(mm_iter == fSplineMap.end() && bm_iter == fBinarySplineMap.end()) {
     SLOG("XSecSplLst", pWARN)
        << "No splines for tune " << fCurrentTune << " were found!";
     return false;
   }
-  const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-  bool exists = (spl_map_curr_tune.count(key) == 1);
+  bool exists =
+    (mm_iter != fSplineMap.end()       && mm_iter->second.count(key) == 1) ||
+    (bm_iter != fBinarySplineMap.end() && bm_iter->second.count(key) == 1);
   SLOG("XSecSplLst", pDEBUG)
     << "Spline found?...." << utils::print::BoolAsYNString(exists);
   return exists;
@@ -135,22 +195,62 @@ const Spline * XSecSplineList::GetSpline(string key) const
   SLOG("XSecSplLst", pDEBUG)
     << "Getting spline: " << key << " in tune: " << fCurrentTune;
 
-  map<string,  map<string, Spline *> >::const_iterator //\/
+  map<string,  map<string, Spline *> >::iterator //
   mm_iter = fSplineMap.find(fCurrentTune);
-  if(mm_iter == fSplineMap.end()) {
+  if(mm_iter != fSplineMap.end()) {
+    map<string, Spline *>::const_iterator //
+    m_iter = mm_iter->second.find(key);
+    if(m_iter != mm_iter->second.end()) return m_iter->second;
+  }
+
+  // Not built yet? Look for the spline in the memory-mapped binary files
+  map<string,  map<string, BinarySpline> >::iterator //
+  bm_iter = fBinarySplineMap.find(fCurrentTune);
+  if(bm_iter != fBinarySplineMap.end()) {
+    map<string, BinarySpline>::iterator b_iter = bm_iter->second.find(key);
+    if(b_iter != bm_iter->second.end()) {
+      const BinarySpline & bspl = b_iter->second;
+      // the Spline ctor copies the knots (it does not modify its inputs)
+      Spline * spline = new Spline(bspl.nknots,
+        const_cast<double *>(bspl.E), const_cast<double *>(bspl.xsec));
+      fSplineMap[fCurrentTune].insert(
+         map<string, Spline *>::value_type(key, spline) );
+      bm_iter->second.erase(b_iter);
+      if(bm_iter->second.empty()) fBinarySplineMap.erase(bm_iter);
+      return spline;
+    }
+  }
+
+  if(mm_iter == fSplineMap.end() && bm_iter == fBinarySplineMap.end()) {
     SLOG("XSecSplLst", pWARN)
        << "No splines for tune " << fCurrentTune << " were found!";
     return 0;
   }
-  const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-  map<string, Spline *>::const_iterator //\/
-  m_iter = spl_map_curr_tune.find(key);
-  if(m_iter == spl_map_curr_tune.end()) {
-    SLOG("XSecSplLst", pWARN)
-      << "Couldn't find spline: " << key << " in tune: " << fCurrentTune;
-    return 0;
+  SLOG("XSecSplLst", pWARN)
+    << "Couldn't find spline: " << key << " in tune: " << fCurrentTune;
+  return 0;
+}
+//____________________________________________________________________________
+void XSecSplineList::BuildBinarySplines(void) const
+{
+// Builds all splines from the memory-mapped binary files not built yet
+
+  map<string,  map<string, BinarySpline> >::const_iterator //
+  bm_iter = fBinarySplineMap.begin();
+  for( ; bm_iter != fBinarySplineMap.end(); ++bm_iter) {
+    map<string, Spline *> & spl_map_curr_tune = fSplineMap[bm_iter->first];
+    map<string, BinarySpline>::const_iterator b_iter = bm_iter->second.begin();
+    for( ; b_iter != bm_iter->second.end(); ++b_iter) {
+      // keep a spline already in the list (eg built after the file was read)
+      if(spl_map_curr_tune.count(b_iter->first) == 1) continue;
+      const BinarySpline & bspl = b_iter->second;
+      Spline * spline = new Spline(bspl.nknots,
+        const_cast<double *>(bspl.E), const_cast<double *>(bspl.xsec));
+      spl_map_curr_tune.insert(
+         map<string, Spline *>::value_type(b_iter->first, spline) );
+    }
   }
-  return m_iter->second;
+  fBinarySplineMap.clear();
 }
 //____________________________________________________________________________
 void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
@@ -174,6 +274,12 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
 
   string key = this->BuildSplineKey(alg,interaction);
 
+  if(!this->IsAssignedToWorker(key)) {
+    SLOG("XSecSplLst", pNOTICE)
+       << "Spline: " << key << " is built by another worker process";
+    return;
+  }
+
   // If any of the nknots,e_min,e_max was not set or its value is not acceptable
   // use the list values
   //
@@ -264,7 +370,7 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
 
   // Save
   //
-  map<string,  map<string, Spline *> >::iterator //\/
+  map<string,  map<string, Spline *> >::iterator //
   mm_iter = fSplineMap.find(fCurrentTune);
   if(mm_iter == fSplineMap.end()) {
     map<string, Spline *> spl_map_curr_tune;
@@ -274,19 +380,45 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   }
   map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
   spl_map_curr_tune.insert( map<string, Spline *>::value_type(key, spline) );
+
+  if(fNWorkers > 1) fWorkerSplineSet[fCurrentTune].insert(key);
+}
+//____________________________________________________________________________
+int XSecSplineList::SplineHandle(
+            const XSecAlgorithmI * alg, const Interaction * interaction)
+{
+// Returns a handle for the spline corresponding to the input algorithm and
+// interaction in the current tune, or -1 if no such spline exists.
+// Use GetSpline(handle) to access the spline.
+
+  const Spline * spl = this->GetSpline(alg, interaction);
+  if(!spl) return -1;
+
+  map<const Spline *, int>::const_iterator it = fSplineHandleMap.find(spl);
+  if(it != fSplineHandleMap.end()) return it->second;
+
+  int handle = (int) fSplineHandles.size();
+  fSplineHandles.push_back(spl);
+  fSplineHandleMap.insert(map<const Spline *, int>::value_type(spl, handle));
+
+  return handle;
 }
 //____________________________________________________________________________
 int XSecSplineList::NSplines(void) const
 {
   map<string,  map<string, Spline *> >::const_iterator //
   mm_iter = fSplineMap.find(fCurrentTune);
-  if(mm_iter == fSplineMap.end()) {
+  map<string,  map<string, BinarySpline> >::const_iterator //
+  bm_iter = fBinarySplineMap.find(fCurrentTune);
+  if(mm_iter == fSplineMap.end() && bm_iter == fBinarySplineMap.end()) {
     SLOG("XSecSplLst", pWARN)
        << "No splines for tune " << fCurrentTune << " were found!";
     return 0;
   }
-  const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-  return (int) spl_map_curr_tune.size();
+  int nspl = 0;
+  if(mm_iter != fSplineMap.end())       nspl += mm_iter->second.size();
+  if(bm_iter != fBinarySplineMap.end()) nspl += bm_iter->second.size();
+  return nspl;
 }
 //____________________________________________________________________________
 bool XSecSplineList::IsEmpty(void) const
@@ -316,6 +448,26 @@ void XSecSplineList::SetMaxE(double Ev)
   if(Ev>0) fEmax = Ev;
 }
 //____________________________________________________________________________
+void XSecSplineList::SetWorker(int nworkers, int iworker)
+{
+  fNWorkers = TMath::Max(1, nworkers);
+  fWorkerId = iworker;
+  fWorkerSplineSet.clear();
+}
+//____________________________________________________________________________
+bool XSecSplineList::IsAssignedToWorker(const string & key) const
+{
+  if(fNWorkers <= 1) return true;
+
+  // FNV-1a hash of the spline key
+  unsigned int hash = 2166136261U;
+  for(unsigned int i = 0; i < key.size(); i++) {
+    hash ^= (unsigned char) key[i];
+    hash *= 16777619U;
+  }
+  return (int) (hash % fNWorkers) == fWorkerId;
+}
+//____________________________________________________________________________
 void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
 {
 //! Save XSecSplineList to XML file
@@ -323,6 +475,8 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
   SLOG("XSecSplLst", pNOTICE)
        << "Saving XSecSplineList as XML in file: " << filename;
 
+  this->BuildBinarySplines();
+
   ofstream outxml(filename.c_str());
   if(!outxml.is_open()) {
     SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
@@ -339,7 +493,7 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
   outxml << endl << endl;
 
   // loop over tunes
-  map<string,  map<string, Spline *> >::const_iterator //\/
+  map<string,  map<string, Spline *> >::const_iterator //
   mm_iter = fSplineMap.begin();
   for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
 
@@ -349,7 +503,7 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
 
     // loop over splines for given tune
     const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-    map<string, Spline *>::const_iterator //\/
+    map<string, Spline *>::const_iterator //
     m_iter = spl_map_curr_tune.begin();
     for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
       string key = m_iter->first;
@@ -358,7 +512,7 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
       // look-up input option to decide whether to write out in
       // new output file or not
       bool from_init_set = false;
-      map<string, set<string> >::const_iterator //\/
+      map<string, set<string> >::const_iterator //
       it = fLoadedSplineSet.find(tune_name);
       if(it != fLoadedSplineSet.end()) {
          const set<string> & init_set_curr_tune = it->second;
@@ -366,6 +520,13 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
       }
       if(from_init_set && !save_init) continue;
 
+      // In a worker process, save only the splines built by this worker
+      // (the list also holds the splines merged from earlier rounds)
+      if(fNWorkers > 1) {
+         it = fWorkerSplineSet.find(tune_name);
+         if(it == fWorkerSplineSet.end() || it->second.count(key) == 0) continue;
+      }
+
       // Add current spline to output file
       Spline * spline = m_iter->second;
       spline->SaveAsXml(outxml,"E","xsec", key);
@@ -379,11 +540,14 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
   outxml.close();
 }
 //____________________________________________________________________________
-XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep)
+XmlParserStatus_t XSecSplineList::LoadFromXml(
+                            const string & filename, bool keep, bool init)
 {
 //! Load XSecSplineList from ROOT file. If keep = true, then the loaded splines
 //! are added to the existing list. If false, then the existing list is reset
-//! before loading the splines.
+//! before loading the splines. If init = true, the loaded splines are added
+//! to the initially loaded set (see SaveAsXml).
+//! Splines already in the list are not replaced.
 
   SLOG("XSecSplLst", pNOTICE)
     << "Loading splines from: " << filename;
@@ -391,7 +555,11 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
     << "Option to keep pre-existing splines is switched "
     << ( (keep) ? "ON" : "OFF" );
 
-  if(!keep) fSplineMap.clear();
+  if(IsBinaryFile(filename)) {
+    return this->LoadFromBinary(filename, keep, init);
+  }
+
+  if(!keep) this->ClearSplines();
 
   const int kNodeTypeStartElement = 1;
   const int kNodeTypeEndElement   = 15;
@@ -485,7 +653,7 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
                delete [] xsec;
 
                // insert the spline to the map
-               map<string,  map<string, Spline *> >::iterator //\/
+               map<string,  map<string, Spline *> >::iterator //
                mm_iter = fSplineMap.find( temp_tune );
                if(mm_iter == fSplineMap.end()) {
                  map<string, Spline *> spl_map_curr_tune;
@@ -494,9 +662,14 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
                  mm_iter = fSplineMap.find( temp_tune );
                }
                map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-               spl_map_curr_tune.insert(
-                  map<string, Spline *>::value_type(spline_name, spline) );
-               fLoadedSplineSet[temp_tune].insert(spline_name);
+               bool inserted = spl_map_curr_tune.insert(
+                  map<string, Spline *>::value_type(spline_name, spline) ).second;
+               if(!inserted) {
+                 delete spline;
+               }
+               else if(init) {
+                 fLoadedSplineSet[temp_tune].insert(spline_name);
+               }
             }
             xmlFree(name);
             xmlFree(value);
@@ -516,6 +689,220 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
   return kXmlOK;
 }
 //____________________________________________________________________________
+bool XSecSplineList::IsBinaryFile(const string & filename)
+{
+  ifstream in(filename.c_str(), std::ios::binary);
+  char magic[8];
+  if(!in.read(magic, 8)) return false;
+  return memcmp(magic, kBinSplMagic, 8) == 0;
+}
+//____________________________________________________________________________
+void XSecSplineList::SaveAsBinary(const string & filename, bool save_init) const
+{
+//! Save XSecSplineList to a binary file, which can then be memory-mapped by
+//! LoadFromBinary (or LoadFromXml). The format is machine-dependent: files
+//! should be converted from XML at each site (see gspladd --binary).
+
+  SLOG("XSecSplLst", pNOTICE)
+       << "Saving XSecSplineList as binary file: " << filename;
+
+  this->BuildBinarySplines();
+
+  // collect the splines to save, in the same order as in SaveAsXml
+  vector<string>         tunes;
+  vector<string>         keys;
+  vector<const Spline *> splines;
+
+  map<string,  map<string, Spline *> >::const_iterator //
+  mm_iter = fSplineMap.begin();
+  for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
+    const string & tune_name = mm_iter->first;
+    const set<string> * init_set_curr_tune = 0;
+    map<string, set<string> >::const_iterator //
+    it = fLoadedSplineSet.find(tune_name);
+    if(it != fLoadedSplineSet.end()) init_set_curr_tune = &(it->second);
+
+    map<string, Spline *>::const_iterator m_iter = mm_iter->second.begin();
+    for( ; m_iter != mm_iter->second.end(); ++m_iter) {
+      bool from_init_set =
+        init_set_curr_tune && init_set_curr_tune->count(m_iter->first) == 1;
+      if(from_init_set && !save_init) continue;
+      tunes  .push_back(tune_name);
+      keys   .push_back(m_iter->first);
+      splines.push_back(m_iter->second);
+    }
+  }
+  uint32_t nspl = splines.size();
+
+  // build the string table & the spline table
+  string strings;
+  vector<BinSplEntry_t> entries(nspl);
+  uint64_t strings_offset =
+     sizeof(BinSplHeader_t) + (uint64_t) nspl * sizeof(BinSplEntry_t);
+  for(uint32_t i = 0; i < nspl; i++) {
+    BinSplEntry_t & entry = entries[i];
+    memset(&entry, 0, sizeof(BinSplEntry_t));
+    entry.fTuneOffset = strings.size();
+    entry.fTuneLength = tunes[i].size();
+    strings += tunes[i];
+    entry.fKeyOffset  = strings.size();
+    entry.fKeyLength  = keys[i].size();
+    strings += keys[i];
+    entry.fNKnots     = splines[i]->NKnots();
+  }
+  uint64_t knots_offset = strings_offset + strings.size();
+  knots_offset = 8 * ((knots_offset + 7) / 8);
+  uint64_t offset = knots_offset;
+  for(uint32_t i = 0; i < nspl; i++) {
+    entries[i].fKnotsOffset = offset;
+    offset += 2 * sizeof(double) * (uint64_t) entries[i].fNKnots;
+  }
+
+  BinSplHeader_t header;
+  memset(&header, 0, sizeof(BinSplHeader_t));
+  memcpy(header.fMagic, kBinSplMagic, 8);
+  header.fByteOrder     = kBinSplByteOrder;
+  header.fVersion       = kBinSplVersion;
+  header.fUseLogE       = (fUseLogE) ? 1 : 0;
+  header.fNSplines      = nspl;
+  header.fStringsOffset = strings_offset;
+  header.fKnotsOffset   = knots_offset;
+
+  ofstream out(filename.c_str(), std::ios::binary);
+  if(!out.is_open()) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
+    return;
+  }
+  out.write((const char *) &header, sizeof(BinSplHeader_t));
+  if(nspl > 0) {
+    out.write((const char *) &entries[0], nspl * sizeof(BinSplEntry_t));
+  }
+  out.write(strings.data(), strings.size());
+  const char padding[8] = { 0,0,0,0,0,0,0,0 };
+  out.write(padding, knots_offset - strings_offset - strings.size());
+
+  for(uint32_t i = 0; i < nspl; i++) {
+    int nknots = entries[i].fNKnots;
+    vector<double> E(nknots), xsec(nknots);
+    for(int iknot = 0; iknot < nknots; iknot++) {
+      splines[i]->GetKnot(iknot, E[iknot], xsec[iknot]);
+    }
+    if(nknots > 0) {
+      out.write((const char *) &E[0],    nknots * sizeof(double));
+      out.write((const char *) &xsec[0], nknots * sizeof(double));
+    }
+  }
+  out.close();
+
+  SLOG("XSecSplLst", pNOTICE) << "Saved " << nspl << " splines";
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromBinary(
+                            const string & filename, bool keep, bool init)
+{
+//! Memory-map a binary spline file (see SaveAsBinary). Only the spline table
+//! is read here: Each spline is built from the mapped knots at first access,
+//! so only the splines used by a job are paged in.
+//! The keep and init flags have the same meaning as in LoadFromXml.
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Loading splines from binary file: " << filename;
+
+  if(!keep) this->ClearSplines();
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file could not be found! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(BinSplHeader_t)) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file is truncated! [filename: " << filename << "]";
+    close(fd);
+    return kXmlNotParsed;
+  }
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file could not be mapped! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+
+  const char * base = (const char *) addr;
+  const BinSplHeader_t * header = (const BinSplHeader_t *) base;
+
+  bool ok = (memcmp(header->fMagic, kBinSplMagic, 8) == 0) &&
+            header->fByteOrder == kBinSplByteOrder &&
+            header->fVersion   == kBinSplVersion;
+  if(!ok) {
+    LOG("XSecSplLst", pERROR)
+      << "\nUnsupported binary spline file (wrong format version or byte "
+      << "order)! [filename: " << filename << "]";
+    munmap(addr, size);
+    return kXmlInvalidRoot;
+  }
+
+  uint64_t nspl = header->fNSplines;
+  uint64_t table_end = sizeof(BinSplHeader_t) + nspl * sizeof(BinSplEntry_t);
+  ok = table_end <= header->fStringsOffset &&
+       header->fStringsOffset <= header->fKnotsOffset &&
+       header->fKnotsOffset <= size && header->fKnotsOffset % 8 == 0;
+
+  const BinSplEntry_t * entries =
+     (const BinSplEntry_t *) (base + sizeof(BinSplHeader_t));
+  const char * strings = base + header->fStringsOffset;
+  uint64_t strings_size = header->fKnotsOffset - header->fStringsOffset;
+
+  // validate the whole table before adding any spline
+  for(uint64_t i = 0; ok && i < nspl; i++) {
+    const BinSplEntry_t & entry = entries[i];
+    ok = entry.fTuneOffset + entry.fTuneLength <= strings_size &&
+         entry.fKeyOffset  + entry.fKeyLength  <= strings_size &&
+         entry.fKnotsOffset >= header->fKnotsOffset &&
+         entry.fKnotsOffset % 8 == 0 &&
+         entry.fKnotsOffset + 2*sizeof(double)*(uint64_t)entry.fNKnots <= size;
+  }
+  if(!ok) {
+    LOG("XSecSplLst", pERROR)
+      << "\nCorrupted binary spline file! [filename: " << filename << "]";
+    munmap(addr, size);
+    return kXmlNotParsed;
+  }
+
+  for(uint64_t i = 0; i < nspl; i++) {
+    const BinSplEntry_t & entry = entries[i];
+    string tune(strings + entry.fTuneOffset, entry.fTuneLength);
+    string key (strings + entry.fKeyOffset,  entry.fKeyLength );
+
+    // splines already in the list are not replaced
+    map<string, map<string, Spline *> >::const_iterator //
+    mm_iter = fSplineMap.find(tune);
+    if(mm_iter != fSplineMap.end() && mm_iter->second.count(key) == 1) continue;
+
+    BinarySpline bspl;
+    bspl.nknots = entry.fNKnots;
+    bspl.E      = (const double *) (base + entry.fKnotsOffset);
+    bspl.xsec   = bspl.E + entry.fNKnots;
+    bool inserted = fBinarySplineMap[tune].insert(
+       map<string, BinarySpline>::value_type(key, bspl) ).second;
+    if(inserted && init) fLoadedSplineSet[tune].insert(key);
+  }
+
+  this->SetLogE(header->fUseLogE == 1);
+
+  fMappedFiles    .push_back(addr);
+  fMappedFileSizes.push_back(size);
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Mapped " << nspl << " splines from: " << filename;
+
+  return kXmlOK;
+}
+//____________________________________________________________________________
 string XSecSplineList::BuildSplineKey(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
@@ -542,7 +929,9 @@ string XSecSplineList::BuildSplineKey(
 //____________________________________________________________________________
 const vector<string> * XSecSplineList::GetSplineKeys(void) const
 {
-  map<string,  map<string, Spline *> >::const_iterator //\/
+  this->BuildBinarySplines();
+
+  map<string,  map<string, Spline *> >::const_iterator //
   mm_iter = fSplineMap.find(fCurrentTune);
   if(mm_iter == fSplineMap.end()) {
     SLOG("XSecSplLst", pWARN)
@@ -571,6 +960,8 @@ void XSecSplineList::Print(ostream & stream) const
   stream << "\n  |-----o  Spline NKnots............." << fNKnots;
   stream << "\n  |";
 
+  this->BuildBinarySplines();
+
   map<string, map<string, Spline *> >::const_iterator mm_iter;
   for(mm_iter = fSplineMap.begin(); mm_iter != fSplineMap.end(); ++mm_iter) {
 
@@ -5,6 +5,13 @@
 
 \brief    List of cross section vs energy splines
 
+          Splines can be saved / loaded in XML or in a binary format. Binary
+          files are memory-mapped read-only (so that their pages are shared
+          by all the processes on a node using them) and each spline is built
+          only when it is first accessed. Note that a built Spline holds a
+          private copy of its knots: only the file pages, and not the splines
+          a job actually uses, are shared between processes.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -49,8 +56,14 @@ public:
   static XSecSplineList * Instance();
 
   // Save/load to/from XML file
+  // (LoadFromXml reads binary files too, see LoadFromBinary)
   void               SaveAsXml   (const string & filename, bool save_init = true) const;
-  XmlParserStatus_t  LoadFromXml (const string & filename, bool keep = false);
+  XmlParserStatus_t  LoadFromXml (const string & filename, bool keep = false, bool init = true);
+
+  // Save/load to/from binary file
+  void               SaveAsBinary   (const string & filename, bool save_init = true) const;
+  XmlParserStatus_t  LoadFromBinary (const string & filename, bool keep = false, bool init = true);
+  static bool        IsBinaryFile   (const string & filename);
 
   // Print available splines
   void   Print (ostream & stream) const;
@@ -61,7 +74,9 @@ public:
   // one for each process, as instructed.
   void   SetCurrentTune (const string & tune) { fCurrentTune = tune; }
   string CurrentTune    (void) const  { return fCurrentTune; }
-  bool   HasSplineFromTune( const string & tune ) const { return fSplineMap.count(tune) > 0 ; }
+  bool   HasSplineFromTune( const string & tune ) const {
+    return fSplineMap.count(tune) > 0 || fBinarySplineMap.count(tune) > 0;
+  }
 
   // Query the existence, access or create a spline
   // The results of the following methods depend on the current tune setting
@@ -74,6 +89,20 @@ public:
   int  NSplines (void) const;
   bool IsEmpty  (void) const;
 
+  // Pre-resolved spline handles, for fast repeated access in the event loop.
+  // Resolving builds the spline key and searches the spline maps once; the
+  // handle can then be turned into a spline with a plain array access.
+  // Handles refer to splines of the current tune and remain valid until the
+  // list is reset (see LoadFromXml). Each reset increments the generation
+  // number, so that holders of handles can tell when to resolve them again.
+  // A negative handle means no spline.
+  int            SplineHandle (const XSecAlgorithmI * alg, const Interaction * i);
+  unsigned int   Generation   (void) const { return fGeneration; }
+  const Spline * GetSpline    (int handle) const {
+    return (handle >= 0 && handle < (int) fSplineHandles.size()) ?
+      fSplineHandles[handle] : 0;
+  }
+
   // Methods for building / getting keys
   // The results of the following methods depend on the current tune setting
   string BuildSplineKey(const XSecAlgorithmI * alg, const Interaction * i) const;
@@ -90,6 +119,14 @@ public:
   double Emin      (void) const { return fEmin;     }
   double Emax      (void) const { return fEmax;     }
 
+  // Share the spline creation among worker processes: CreateSpline builds
+  // only the splines assigned to the current worker (based on the spline key,
+  // so that the assignment does not depend on the order of the calls) and
+  // SaveAsXml saves only the splines built by the current worker
+  void   SetWorker  (int nworkers, int iworker);
+  int    NWorkers   (void) const { return fNWorkers; }
+  bool   IsAssignedToWorker (const string & spline_key) const;
+
 private:
 
   XSecSplineList();
@@ -102,11 +139,32 @@ private:
   int    fNKnots;
   double fEmin;
   double fEmax;
+  int    fNWorkers;
+  int    fWorkerId;
 
   string fCurrentTune; ///< The `active' tune, out the many that can co-exist
 
-  map<string, map<string, Spline *> > fSplineMap;       ///< tune -> { xsec_alg/xsec_config/interaction -> Spline }
-  map<string, set<string>           > fLoadedSplineSet; ///< tune -> { set of initialy loaded splines             }
+  //! Knots of a spline in a memory-mapped binary file
+  struct BinarySpline {
+    const double * E;
+    const double * xsec;
+    int            nknots;
+  };
+
+  void ClearSplines       (void);
+  void BuildBinarySplines (void) const;
+
+  mutable map<string, map<string, Spline *> >      fSplineMap;       ///< tune -> { xsec_alg/xsec_config/interaction -> Spline }
+  map<string, set<string>           >              fLoadedSplineSet; ///< tune -> { set of initialy loaded splines             }
+  map<string, set<string>           >              fWorkerSplineSet; ///< tune -> { set of splines built by this worker      }
+  mutable map<string, map<string, BinarySpline> >  fBinarySplineMap; ///< tune -> { key -> knots of splines not built yet }
+
+  vector<void *> fMappedFiles;     ///< memory-mapped binary spline files
+  vector<size_t> fMappedFileSizes; ///< ... and their sizes
+
+  vector<const Spline *>     fSplineHandles;    ///< handle -> spline
+  map<const Spline *, int>   fSplineHandleMap;  ///< spline -> handle
+  unsigned int               fGeneration;       ///< number of times the list was reset (invalidating the handles)
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -0,0 +1,146 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <cassert>
+
+#include <TMath.h>
+#include <TRandom3.h>
+
+#include "Physics/Common/KineEnvelope.h"
+
+using namespace genie;
+
+ClassImp(KineEnvelope);
+
+//____________________________________________________________________________
+namespace genie
+{
+  ostream & operator << (ostream & stream, const KineEnvelope & env)
+  {
+     env.Print(stream);
+     return stream;
+  }
+}
+//____________________________________________________________________________
+KineEnvelope::KineEnvelope(void) :
+CacheBranchI(),
+fNDim(0),
+fNBins(0),
+fNRaised(0)
+{
+
+}
+//____________________________________________________________________________
+KineEnvelope::KineEnvelope(int ndim, int nbins) :
+CacheBranchI(),
+fNDim(ndim),
+fNBins(nbins),
+fNRaised(0)
+{
+  assert(ndim > 0 && ndim <= 3 && nbins > 0);
+
+  int ncells = 1;
+  for(int k = 0; k < ndim; k++) ncells *= nbins;
+
+  fHeight.assign(ncells, 0.);
+  fCumul .assign(ncells, 0.);
+}
+//____________________________________________________________________________
+KineEnvelope::~KineEnvelope()
+{
+
+}
+//____________________________________________________________________________
+void KineEnvelope::CellBounds(int ic, double * umin, double * umax) const
+{
+  for(int k = 0; k < fNDim; k++) {
+    int ib = ic % fNBins;
+    ic /= fNBins;
+    umin[k] = double(ib)   / fNBins;
+    umax[k] = double(ib+1) / fNBins;
+  }
+}
+//____________________________________________________________________________
+int KineEnvelope::Cell(const double * u) const
+{
+  int ic     = 0;
+  int stride = 1;
+  for(int k = 0; k < fNDim; k++) {
+    int ib = TMath::Min(fNBins-1, TMath::Max(0, int(u[k]*fNBins)));
+    ic     += ib * stride;
+    stride *= fNBins;
+  }
+  return ic;
+}
+//____________________________________________________________________________
+void KineEnvelope::Update(void)
+{
+  double sum = 0;
+  for(unsigned int ic = 0; ic < fHeight.size(); ic++) {
+    sum += fHeight[ic];
+    fCumul[ic] = sum;
+  }
+}
+//____________________________________________________________________________
+double KineEnvelope::Mean(void) const
+{
+  if(fCumul.empty()) return 0;
+  return fCumul.back() / fCumul.size();
+}
+//____________________________________________________________________________
+double KineEnvelope::Generate(TRandom3 & rnd, double * u) const
+{
+// All cells have the same volume: select a cell with probability proportional
+// to its height and then a point uniformly within the cell
+
+  double r = fCumul.back() * rnd.Rndm();
+  int ic = std::upper_bound(fCumul.begin(), fCumul.end(), r) - fCumul.begin();
+  ic = TMath::Min(ic, this->NCells()-1);
+
+  double umin[3], umax[3];
+  this->CellBounds(ic, umin, umax);
+  for(int k = 0; k < fNDim; k++) {
+    u[k] = umin[k] + (umax[k]-umin[k]) * rnd.Rndm();
+  }
+  return fHeight[ic];
+}
+//____________________________________________________________________________
+void KineEnvelope::Raise(const double * u, double h)
+{
+  int ic = this->Cell(u);
+  if(h <= fHeight[ic]) return;
+
+  fHeight[ic] = h;
+  fNRaised++;
+  this->Update();
+}
+//____________________________________________________________________________
+void KineEnvelope::Reset(void)
+{
+  fHeight.assign(fHeight.size(), 0.);
+  fCumul .assign(fCumul .size(), 0.);
+  fNRaised = 0;
+}
+//____________________________________________________________________________
+void KineEnvelope::Print(ostream & stream) const
+{
+  double hmax = 0;
+  int    nzero = 0;
+  for(unsigned int ic = 0; ic < fHeight.size(); ic++) {
+    hmax = TMath::Max(hmax, fHeight[ic]);
+    if(fHeight[ic] <= 0) nzero++;
+  }
+
+  stream << "\n [-] Kinematic envelope: " << fNDim << " variables, "
+         << fNBins << " bins per variable";
+  stream << "\n  |--> max height  = " << hmax;
+  stream << "\n  |--> mean height = " << this->Mean();
+  stream << "\n  |--> empty cells = " << nzero << " / " << this->NCells();
+  stream << "\n";
+}
+//____________________________________________________________________________
@@ -0,0 +1,107 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::KineEnvelope
+
+\brief   A piecewise-constant envelope of a differential cross section over
+         the unit hypercube (in 1 to 3 dimensions) spanned by the kinematic
+         variables of a KineGeneratorWithCache, for use in the rejection
+         method in place of a flat envelope at the maximum cross section.
+
+         The hypercube is divided into nbins^ndim equal cells. Each cell
+         holds an upper bound of the cross section in that cell (see
+         KineGeneratorWithCache::BuildEnvelope()). Points are generated
+         with a density proportional to the envelope and accepted with a
+         probability xsec/height, so the accepted kinematics are unweighted
+         and distributed exactly as the cross section, as with the flat
+         envelope, but far fewer cross section evaluations are wasted when
+         the cross section is peaked.
+
+         Envelopes are stored in the GENIE Cache, one per algorithm,
+         interaction and energy bin.
+
+\author  GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _KINE_ENVELOPE_H_
+#define _KINE_ENVELOPE_H_
+
+#include <iostream>
+#include <vector>
+
+#include "Framework/Utils/CacheBranchI.h"
+
+class TRandom3;
+
+using std::ostream;
+using std::vector;
+
+namespace genie {
+
+class KineEnvelope;
+ostream & operator << (ostream & stream, const KineEnvelope & env);
+
+class KineEnvelope : public CacheBranchI
+{
+public:
+  using TObject::Print; // suppress clang 'hides overloaded virtual function [-Woverloaded-virtual]' warnings
+
+  KineEnvelope();
+  KineEnvelope(int ndim, int nbins);
+  ~KineEnvelope();
+
+  int    NDim   (void)   const { return fNDim;          }
+  int    NBins  (void)   const { return fNBins;         }
+  int    NCells (void)   const { return fHeight.size(); }
+  double Height (int ic) const { return fHeight[ic];    }
+
+  //! Bounds of the cell ic in the unit hypercube
+  void   CellBounds (int ic, double * umin, double * umax) const;
+
+  //! Cell containing the point u of the unit hypercube
+  int    Cell       (const double * u) const;
+
+  //! Set the envelope height in cell ic (call Update() when done)
+  void   SetHeight  (int ic, double h) { fHeight[ic] = h; }
+
+  //! Recompute the cell selection probabilities
+  void   Update     (void);
+
+  //! Mean envelope height (the height of a flat envelope of equal volume)
+  double Mean       (void) const;
+
+  //! Generate a point u with a density proportional to the envelope and
+  //! return the envelope height at u
+  double Generate   (TRandom3 & rnd, double * u) const;
+
+  //! Raise the envelope at the point u to the input height
+  void   Raise      (const double * u, double h);
+
+  //! Number of times the envelope was raised (cross section violations)
+  long   NRaised    (void) const { return fNRaised; }
+
+  void   Reset      (void);
+  void   Print      (ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const KineEnvelope & env);
+
+private:
+
+  int            fNDim;    ///< number of kinematic variables
+  int            fNBins;   ///< number of bins per variable
+  vector<double> fHeight;  ///< envelope height, per cell
+  vector<double> fCumul;   ///< cumulative sum of cell heights
+  long           fNRaised; //! number of times the envelope was raised (not stored)
+
+ClassDef(KineEnvelope,1)
+};
+
+}      // genie namespace
+
+#endif // _KINE_ENVELOPE_H_
@@ -11,10 +11,12 @@
 #include <sstream>
 #include <cstdlib>
 #include <map>
+#include <vector>
 
 //#include <TSQLResult.h>
 //#include <TSQLRow.h>
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Physics/Common/KineGeneratorWithCache.h"
@@ -24,27 +26,40 @@
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Physics/Common/KineEnvelope.h"
+
+// adaptive envelope: energy bins per decade & refinement threshold (cells
+// where the min/max xsec ratio is below it are sampled on a finer grid)
+static const double kNEnvelopeEBinsPerDecade = 20.;
+static const double kEnvelopeRefineRatio     = 0.5;
 
 using std::ostringstream;
 using std::map;
+using std::vector;
 
 using namespace genie;
 
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache() :
-EventRecordVisitorI()
+EventRecordVisitorI(),
+fUseEnvelope(false),
+fEnvelopeNBins(0)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name) :
-EventRecordVisitorI(name)
+EventRecordVisitorI(name),
+fUseEnvelope(false),
+fEnvelopeNBins(0)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name, string config) :
-EventRecordVisitorI(name, config)
+EventRecordVisitorI(name, config),
+fUseEnvelope(false),
+fEnvelopeNBins(0)
 {
 
 }
@@ -270,3 +285,163 @@ void KineGeneratorWithCache::AssertXSecLimits(
   }
 }
 //___________________________________________________________________________
+KineEnvelope * KineGeneratorWithCache::Envelope(GHepRecord * event_rec) const
+{
+  if(!fUseEnvelope || fGenerateUniformly) return 0;
+
+  int ndim = this->EnvelopeNDim();
+  if(ndim <= 0) return 0;
+
+  Interaction * interaction = event_rec->Summary();
+
+  // as for the cached max xsec, force the flat envelope (explicit max xsec
+  // calculation) at low energies
+  double E = this->Energy(interaction);
+  if(E < fEMin) return 0;
+
+  int ebin = TMath::FloorNint(kNEnvelopeEBinsPerDecade * TMath::Log10(E));
+
+  Cache * cache = Cache::Instance();
+
+  // build the cache branch key as: namespace::algorithm/config/interaction/E-bin
+  ostringstream ekey;
+  ekey << "envelope@E-bin=" << ebin;
+  string key = cache->CacheBranchKey(
+                  this->Id().Key(), interaction->AsString(), ekey.str());
+
+  KineEnvelope * envelope =
+              dynamic_cast<KineEnvelope *> (cache->FindCacheBranch(key));
+  if(!envelope) {
+    LOG("Kinematics", pINFO) << "Creating kinematic envelope - key = " << key;
+
+    // the envelope serves all energies in the bin: build it at the upper
+    // edge of the bin, where the xsec is typically largest (bin ebin spans
+    // log10(E) in [ebin, ebin+1) / kNEnvelopeEBinsPerDecade), with a copy of
+    // the interaction with the probe 4-momentum scaled accordingly.
+    // Any remaining violation raises the envelope (see KineEnvelope::Raise())
+    double Eup = TMath::Power(10., (ebin + 1.) / kNEnvelopeEBinsPerDecade);
+    Interaction in_up(*interaction);
+    in_up.SetBit(interaction->TestBits(TObject::kBitMask), true);
+    TLorentzVector * p4 = interaction->InitState().GetProbeP4(kRfLab);
+    in_up.InitStatePtr()->SetProbeP4((Eup/E) * (*p4));
+    delete p4;
+
+    envelope = new KineEnvelope(ndim, fEnvelopeNBins);
+    this->BuildEnvelope(&in_up, envelope);
+    cache->AddCacheBranch(key, envelope);
+
+    LOG("Kinematics", pINFO) << *envelope;
+  }
+
+  // no non-zero xsec found on the grid: fall back to the flat envelope
+  if(envelope->Mean() <= 0) return 0;
+
+  return envelope;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::BuildEnvelope(
+                        Interaction * interaction, KineEnvelope * env) const
+{
+// The height of each cell is the max xsec at its corners, its centre and, if
+// the xsec varies strongly across the cell, at 2^ndim more points inside it,
+// times the safety factor. Empty cells next to non-empty ones take the height
+// of their neighbours, so that allowed regions missed by the grid points are
+// still sampled.
+
+  int ndim  = env->NDim();
+  int nbins = env->NBins();
+  int ncell = env->NCells();
+  int nsub  = 1 << ndim;
+
+  double u[3], umin[3], umax[3];
+
+  // xsec at the grid nodes
+  int nnode = 1;
+  for(int k = 0; k < ndim; k++) nnode *= (nbins+1);
+  vector<double> xsec_node(nnode, 0.);
+  for(int inode = 0; inode < nnode; inode++) {
+    int j = inode;
+    for(int k = 0; k < ndim; k++) {
+      u[k] = double(j % (nbins+1)) / nbins;
+      j /= (nbins+1);
+    }
+    xsec_node[inode] = TMath::Max(0., this->EnvelopeXSec(interaction, u));
+  }
+
+  // max xsec in each cell
+  vector<double> xsec_cell(ncell, 0.);
+  for(int ic = 0; ic < ncell; ic++) {
+    int ib[3];
+    int j = ic;
+    for(int k = 0; k < ndim; k++) { ib[k] = j % nbins; j /= nbins; }
+
+    double xmin = -1;
+    double xmax =  0;
+    for(int isub = 0; isub < nsub; isub++) {
+      int inode  = 0;
+      int stride = 1;
+      for(int k = 0; k < ndim; k++) {
+        inode  += (ib[k] + ((isub >> k) & 1)) * stride;
+        stride *= (nbins+1);
+      }
+      double xsec = xsec_node[inode];
+      xmax = TMath::Max(xmax, xsec);
+      xmin = (xmin < 0) ? xsec : TMath::Min(xmin, xsec);
+    }
+
+    env->CellBounds(ic, umin, umax);
+    for(int k = 0; k < ndim; k++) u[k] = 0.5 * (umin[k] + umax[k]);
+    double xsec = TMath::Max(0., this->EnvelopeXSec(interaction, u));
+    xmax = TMath::Max(xmax, xsec);
+    xmin = TMath::Min(xmin, xsec);
+
+    if(xmax > 0 && xmin < kEnvelopeRefineRatio * xmax) {
+      for(int isub = 0; isub < nsub; isub++) {
+        for(int k = 0; k < ndim; k++) {
+          double f = ((isub >> k) & 1) ? 2./3. : 1./3.;
+          u[k] = umin[k] + f * (umax[k] - umin[k]);
+        }
+        xsec = TMath::Max(0., this->EnvelopeXSec(interaction, u));
+        xmax = TMath::Max(xmax, xsec);
+      }
+    }
+    xsec_cell[ic] = xmax;
+  }
+
+  // set the envelope heights
+  int nnbr = 1;
+  for(int k = 0; k < ndim; k++) nnbr *= 3;
+  for(int ic = 0; ic < ncell; ic++) {
+    double xmax = xsec_cell[ic];
+    if(xmax <= 0) {
+      int ib[3];
+      int j = ic;
+      for(int k = 0; k < ndim; k++) { ib[k] = j % nbins; j /= nbins; }
+      for(int inbr = 0; inbr < nnbr; inbr++) {
+        int jc     = 0;
+        int stride = 1;
+        int jn     = inbr;
+        bool valid = true;
+        for(int k = 0; k < ndim; k++) {
+          int jb = ib[k] + (jn % 3) - 1;
+          jn /= 3;
+          if(jb < 0 || jb >= nbins) { valid = false; break; }
+          jc     += jb * stride;
+          stride *= nbins;
+        }
+        if(valid) xmax = TMath::Max(xmax, xsec_cell[jc]);
+      }
+    }
+    env->SetHeight(ic, fSafetyFactor * xmax);
+  }
+  env->Update();
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::EnvelopeXSec(
+                             Interaction * /*in*/, const double * /*u*/) const
+{
+  LOG("Kinematics", pERROR)
+     << "The adaptive envelope is not supported by " << this->Id().Key();
+  return 0;
+}
+//___________________________________________________________________________
@@ -13,6 +13,14 @@
           method for computing the maximum xsec in case it has not already
           being pushed into the cache at a previous iteration.
 
+          Generators sampling their kinematic variables uniformly over a box
+          can instead use an adaptive, piecewise-constant envelope of the
+          differential xsec in the rejection method (see KineEnvelope), by
+          implementing EnvelopeNDim() and EnvelopeXSec(). The envelope is
+          built per interaction and energy bin, cached, and used only if
+          the AdaptiveEnvelope option is set. It does not suit generators
+          that also sample the hit nucleon in each trial (QELEventGenerator).
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -37,6 +45,7 @@ using std::string;
 namespace genie {
 
 class CacheBranchFx;
+class KineEnvelope;
 class XSecAlgorithmI;
 
 class KineGeneratorWithCache : public EventRecordVisitorI {
@@ -57,12 +66,26 @@ protected:
 
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
+  //! Adaptive envelope for the current interaction & energy, or 0 if the
+  //! flat envelope at MaxXSec() is to be used
+  virtual KineEnvelope * Envelope      (GHepRecord * evrec) const;
+  virtual void           BuildEnvelope (Interaction * in, KineEnvelope * env) const;
+
+  //! Number of kinematic variables sampled by the generator (0: the adaptive
+  //! envelope is not supported) and the differential xsec at the point u of
+  //! the unit hypercube mapped onto their current ranges (sets the running
+  //! kinematics of the input interaction)
+  virtual int            EnvelopeNDim  (void) const { return 0; }
+  virtual double         EnvelopeXSec  (Interaction * in, const double * u) const;
+
   mutable const XSecAlgorithmI * fXSecModel;
 
   double fSafetyFactor;         ///< maxxsec -> maxxsec * safety_factor
   double fMaxXSecDiffTolerance; ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
   double fEMin;                 ///< min E for which maxxsec is cached - forcing explicit calc.
   bool   fGenerateUniformly;    ///< uniform over allowed phase space + event weight?
+  bool   fUseEnvelope;          ///< use an adaptive envelope in the rejection method?
+  int    fEnvelopeNBins;        ///< adaptive envelope bins per kinematic variable
 };
 
 }      // genie namespace
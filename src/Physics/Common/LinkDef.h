@@ -18,5 +18,6 @@
 #pragma link C++ class genie::OutgoingDarkGenerator;
 #pragma link C++ class genie::HadronicSystemGenerator;
 #pragma link C++ class genie::KineGeneratorWithCache;
+#pragma link C++ class genie::KineEnvelope;
 
 #endif
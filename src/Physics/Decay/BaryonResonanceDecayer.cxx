@@ -26,6 +26,7 @@
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepRecord.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/StringUtils.h"
@@ -312,16 +313,21 @@ bool BaryonResonanceDecayer::DecayExclusive(
   // The particle will be decayed in its rest frame and then the daughters
   // will be boosted back to the original frame.
 
-  bool is_permitted = fPhaseSpaceGenerator.SetDecay(decay_particle_p4, nd, mass);
+  // The daughters are set in the canonical order of the maximum weight
+  // tables (see NBodyPhaseSpace): daughter i is decay product index[i].
+  double smass[nd];
+  int    index[nd];
+  NBodyPhaseSpace::SortMasses(nd, mass, smass, index);
+
+  bool is_permitted = fPhaseSpaceGenerator.SetDecay(decay_particle_p4, nd, smass);
   if ( ! is_permitted ) return false ;
 
   // Find the maximum phase space decay weight
-  // double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int i=0; i<50; i++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
+  NBodyPhaseSpace * psmax = NBodyPhaseSpace::Instance();
+  double M = decay_particle_p4.M();
+  // (weighted decays are normalized to the sampled maximum, with no margin)
+  double wmax = (fGenerateWeighted) ?
+     psmax->SampledWeightMax(M, nd, smass) : psmax->WeightMax(M, nd, smass);
   assert(wmax>0);
   LOG("ResonanceDecay", pINFO)
     << "Max phase space gen. weight for current decay: " << wmax;
@@ -338,7 +344,6 @@ bool BaryonResonanceDecayer::DecayExclusive(
   {
     // Generating un-weighted decays
     RandomGen * rnd = RandomGen::Instance();
-    wmax *= 2;
     bool accept_decay=false;
     unsigned int itry=0;
 
@@ -353,6 +358,7 @@ bool BaryonResonanceDecayer::DecayExclusive(
       if(w>wmax) {
          LOG("ResonanceDecay", pWARN)
             << "Current decay weight = " << w << " > wmax = " << wmax;
+         psmax->RaiseWeightMax(M, nd, smass, w);
       }
       LOG("ResonanceDecay", pINFO)
         << "Current decay weight = " << w << " / R = " << gw;
@@ -388,7 +394,7 @@ bool BaryonResonanceDecayer::DecayExclusive(
           }
         }//iparticle
 
-        TLorentzVector * lab_pion = fPhaseSpaceGenerator.GetDecay(pi_id);
+        TLorentzVector * lab_pion = fPhaseSpaceGenerator.GetDecay(index[pi_id]);
 
         accept_decay = AcceptPionDecay( *lab_pion, decay_particle_id, event) ;
 
@@ -411,7 +417,7 @@ bool BaryonResonanceDecayer::DecayExclusive(
 
      int daughter_pdg_code = pdgc[id];
 
-     TLorentzVector * daughter_p4 = fPhaseSpaceGenerator.GetDecay(id);
+     TLorentzVector * daughter_p4 = fPhaseSpaceGenerator.GetDecay(index[id]);
      LOG("ResonanceDecay", pDEBUG)
         << "Adding daughter particle with PDG code = " << pdgc[id]
         << " and mass = " << mass[id] << " GeV";
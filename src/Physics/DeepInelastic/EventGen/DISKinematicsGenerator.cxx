@@ -27,6 +27,7 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Physics/Common/KineEnvelope.h"
 #include "Framework/ParticleData/PDGUtils.h"
 
 using namespace genie;
@@ -100,8 +101,12 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space the max xsec is irrelevant.
+  //   If an adaptive envelope is used, the max xsec is the envelope height
+  //   at the generated kinematics
+  KineEnvelope * envelope = this->Envelope(evrec);
+  double xsec_max =
+     (fGenerateUniformly || envelope) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
@@ -124,8 +129,15 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      }
 
      //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
+     double u[2];
+     if(envelope) {
+       xsec_max = envelope->Generate(rnd->RndKine(), u);
+     } else {
+       u[0] = rnd->RndKine().Rndm();
+       u[1] = rnd->RndKine().Rndm();
+     }
+     gx = xl.min + dx * u[0];
+     gy = yl.min + dy * u[1];
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
      kinematics::UpdateWQ2FromXY(interaction);
@@ -141,6 +153,7 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
         this->AssertXSecLimits(interaction, xsec, xsec_max);
+        if(envelope && xsec > xsec_max) envelope->Raise(u, fSafetyFactor*xsec);
         double t = xsec_max * rnd->RndKine().Rndm();
 	double J = 1;
 
@@ -233,6 +246,10 @@ void DISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Sample (x,y) from an adaptive envelope of the differential xsec
+  //   rather than a flat one?
+    GetParamDef( "AdaptiveEnvelope", fUseEnvelope, false ) ;
+    GetParamDef( "AdaptiveEnvelope-NBins", fEnvelopeNBins, 20 ) ;
 }
 //____________________________________________________________________________
 double DISKinematicsGenerator::ComputeMaxXSec(
@@ -375,3 +392,20 @@ double DISKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+double DISKinematicsGenerator::EnvelopeXSec(
+                     Interaction * interaction, const double * u) const
+{
+// Sets (x,y) at the point u of the unit square mapped onto the x,y limits
+// and returns the differential xsec (see KineGeneratorWithCache)
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t xl = kps.Limits(kKVx);
+  Range1D_t yl = kps.Limits(kKVy);
+
+  interaction->KinePtr()->Setx(xl.min + (xl.max - xl.min) * u[0]);
+  interaction->KinePtr()->Sety(yl.min + (yl.max - yl.min) * u[1]);
+  kinematics::UpdateWQ2FromXY(interaction);
+
+  return fXSecModel->XSec(interaction, kPSxyfE);
+}
+//___________________________________________________________________________
@@ -47,6 +47,8 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  int    EnvelopeNDim    (void) const { return 2; }
+  double EnvelopeXSec    (Interaction * interaction, const double * u) const;
 };
 
 }      // genie namespace
@@ -15,7 +15,6 @@
 #include <sstream>
 
 #include <TMath.h>
-#include <TH1D.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Units.h"
@@ -114,16 +113,15 @@ double KNOTunedQPMDISPXSec::DISRESJoinSuppressionFactor(
   double y    = in->Kine().y();
   double Wo   = utils::kinematics::XYtoW(E,Mnuc,x,y);
 
-  TH1D * mprob = 0;
+  double mprob[AGKYLowW2019::kMaxPSMultiplicity+1];
 
   if(!fUseCache) {
     // ** Compute the reduction factor at each call - no caching
     //
-    mprob = fHadronizationModel->MultiplicityProb(in,"+LowMultSuppr");
     R = 1;
-    if(mprob) {
-       R = mprob->Integral("width");
-       delete mprob;
+    if(fHadronizationModel->MultiplicityProb(in,"+LowMultSuppr",mprob) >= 2) {
+       R = 0;
+       for(int n = 0; n <= AGKYLowW2019::kMaxPSMultiplicity; n++) R += mprob[n];
     }
   }
   else {
@@ -164,11 +162,10 @@ double KNOTunedQPMDISPXSec::DISRESJoinSuppressionFactor(
       for(int i=0; i<kN; i++) {
         double W = WminSpl+i*dW;
         interaction.KinePtr()->SetW(W);
-        mprob = fHadronizationModel->MultiplicityProb(&interaction,"+LowMultSuppr");
         R = 1;
-        if(mprob) {
-           R = mprob->Integral("width");
-           delete mprob;
+        if(fHadronizationModel->MultiplicityProb(&interaction,"+LowMultSuppr",mprob) >= 2) {
+           R = 0;
+           for(int n = 0; n <= AGKYLowW2019::kMaxPSMultiplicity; n++) R += mprob[n];
         }
         // make sure that it takes enough samples where it is non-zero:
         // modify the step and the sample counter once I've hit the first
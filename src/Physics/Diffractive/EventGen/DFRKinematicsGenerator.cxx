@@ -28,6 +28,7 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Physics/Common/KineEnvelope.h"
 #include "Framework/ParticleData/PDGUtils.h"
 
 using namespace genie;
@@ -114,8 +115,12 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space the max xsec is irrelevant.
+  //   If an adaptive envelope is used, the max xsec is the envelope height
+  //   at the generated kinematics
+  KineEnvelope * envelope = this->Envelope(evrec);
+  double xsec_max =
+     (fGenerateUniformly || envelope) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid (x,y,t) triplet using the rejection method
 
@@ -139,9 +144,17 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      }
 
      //-- random x,y,t
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
-     gt = tl.min + dt * rnd->RndKine().Rndm();
+     double u[3];
+     if(envelope) {
+       xsec_max = envelope->Generate(rnd->RndKine(), u);
+     } else {
+       u[0] = rnd->RndKine().Rndm();
+       u[1] = rnd->RndKine().Rndm();
+       u[2] = rnd->RndKine().Rndm();
+     }
+     gx = xl.min + dx * u[0];
+     gy = yl.min + dy * u[1];
+     gt = tl.min + dt * u[2];
 
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
@@ -156,6 +169,7 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
         this->AssertXSecLimits(interaction, xsec, xsec_max);
+        if(envelope && xsec > xsec_max) envelope->Raise(u, fSafetyFactor*xsec);
         double n = xsec_max * rnd->RndKine().Rndm();
         double J = 1;
 
@@ -243,6 +257,11 @@ void DFRKinematicsGenerator::LoadConfig(void)
   //   an event weight?
   GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Sample (x,y,t) from an adaptive envelope of the differential xsec
+  //   rather than a flat one?
+  GetParamDef( "AdaptiveEnvelope", fUseEnvelope, false ) ;
+  GetParamDef( "AdaptiveEnvelope-NBins", fEnvelopeNBins, 8 ) ;
+
   GetParam( "DFR-Beta", fBeta ) ;
 
 }
@@ -351,3 +370,22 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+double DFRKinematicsGenerator::EnvelopeXSec(
+                     Interaction * interaction, const double * u) const
+{
+// Sets (x,y,t) at the point u of the unit cube mapped onto the x,y,t limits
+// used in ProcessEventRecord() and returns the differential xsec
+// (see KineGeneratorWithCache)
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t xl = kps.Limits(kKVx);
+  Range1D_t yl = kps.Limits(kKVy);
+  double tmax = KPhaseSpace::GetTMaxDFR();
+
+  interaction->KinePtr()->Setx(xl.min + (xl.max - xl.min) * u[0]);
+  interaction->KinePtr()->Sety(yl.min + (yl.max - yl.min) * u[1]);
+  interaction->KinePtr()->Sett(tmax * u[2]);
+
+  return fXSecModel->XSec(interaction, kPSxytfE);
+}
+//___________________________________________________________________________
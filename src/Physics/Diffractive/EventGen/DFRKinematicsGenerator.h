@@ -42,6 +42,8 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  int    EnvelopeNDim    (void) const { return 3; }
+  double EnvelopeXSec    (Interaction * interaction, const double * u) const;
 
   double fBeta;
 };
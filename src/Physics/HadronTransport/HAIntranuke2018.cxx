@@ -1532,6 +1532,8 @@ void HAIntranuke2018::LoadConfig(void)
 
   GetParam( "INUKE-NucRemovalE",   fNucRmvE );        // GeV
   GetParam( "INUKE-HadStep",       fHadStep ) ;
+  GetParamDef( "INUKE-DeltaTracking", fDeltaTracking, false ) ;
+  GetParamDef( "INUKE-MFPTable",      fUseMFPTable,   false ) ;
   GetParam( "INUKE-NucAbsFac",     fNucAbsFac ) ;
   GetParam( "INUKE-NucCEXFac",     fNucCEXFac ) ;
   GetParam( "INUKE-Energy_Pre_Eq", fEPreEq ) ;
@@ -1565,6 +1567,8 @@ void HAIntranuke2018::LoadConfig(void)
   LOG("HAIntranuke2018", pINFO) << "DelRPion    = " << fDelRPion;
   LOG("HAIntranuke2018", pINFO) << "DelRNucleon = " << fDelRNucleon;
   LOG("HAIntranuke2018", pINFO) << "HadStep     = " << fHadStep << " fermi";
+  LOG("HAIntranuke2018", pINFO) << "DeltaTrack? = " << ((fDeltaTracking)?(true):(false));
+  LOG("HAIntranuke2018", pINFO) << "MFPTable?   = " << ((fUseMFPTable)?(true):(false));
   LOG("HAIntranuke2018", pINFO) << "EPreEq      = " << fHadStep << " fermi";
   LOG("HAIntranuke2018", pINFO) << "NucAbsFac   = " << fNucAbsFac;
   LOG("HAIntranuke2018", pINFO) << "NucCEXFac   = " << fNucCEXFac;
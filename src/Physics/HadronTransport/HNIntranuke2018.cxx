@@ -963,6 +963,8 @@ void HNIntranuke2018::LoadConfig(void)
 
   GetParam( "INUKE-NucRemovalE",   fNucRmvE );        // GeV
   GetParam( "INUKE-HadStep",       fHadStep ) ;
+  GetParamDef( "INUKE-DeltaTracking", fDeltaTracking, false ) ;
+  GetParamDef( "INUKE-MFPTable",      fUseMFPTable,   false ) ;
   GetParam( "INUKE-NucAbsFac",     fNucAbsFac ) ;
   GetParam( "INUKE-NucQEFac",      fNucQEFac ) ;
   GetParam( "INUKE-NucCEXFac",     fNucCEXFac ) ;
@@ -989,6 +991,8 @@ void HNIntranuke2018::LoadConfig(void)
   LOG("HNIntranuke2018", pWARN) << "DelRPion    = " << fDelRPion;
   LOG("HNIntranuke2018", pWARN) << "DelRNucleon = " << fDelRNucleon;
   LOG("HNIntranuke2018", pWARN) << "HadStep     = " << fHadStep << " fermi";
+  LOG("HNIntranuke2018", pWARN) << "DeltaTrack? = " << ((fDeltaTracking)?(true):(false));
+  LOG("HNIntranuke2018", pWARN) << "MFPTable?   = " << ((fUseMFPTable)?(true):(false));
   LOG("HNIntranuke2018", pWARN) << "NucAbsFac   = " << fNucAbsFac;
   LOG("HNIntranuke2018", pWARN) << "NucQEFac    = " << fNucQEFac;
   LOG("HNIntranuke2018", pWARN) << "NucCEXFac   = " << fNucCEXFac;
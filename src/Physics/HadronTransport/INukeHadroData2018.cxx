@@ -66,6 +66,11 @@ INukeHadroData2018 * INukeHadroData2018::fInstance = 0;
 double INukeHadroData2018::fMinKinEnergy   =    1.0; // MeV
 double INukeHadroData2018::fMaxKinEnergyHA =  999.0; // MeV
 double INukeHadroData2018::fMaxKinEnergyHN = 1799.0; // MeV
+
+// Grid of the tabulated pi+A fate fractions (see FracADepTable)
+static const int    kFracADepMaxA   = 208;  // A = 1, 2, ..., kFracADepMaxA
+static const double kFracADepKEStep = 2.0;  // MeV
+static const int    kFracADepNFates = 4;    // CEx, Inelas, Abs, PiPro
 //____________________________________________________________________________
 INukeHadroData2018::INukeHadroData2018()
 {
@@ -1173,10 +1178,46 @@ void INukeHadroData2018::LoadCrossSections(void)
 
    TGraphs_file.Close();
 
+   // The Delaunay interpolation of the TGraph2Ds is far too slow to be run
+   // at each hadron step: The fractions are tabulated in KE, for each target
+   // A, when first queried (see FracADepTable)
+   fFracPipATable.assign(kFracADepMaxA+1, vector<double>());
+
    LOG("INukeData", pINFO)  << "Done building x-section splines...";
    
 }
 //____________________________________________________________________________
+const vector<double> & INukeHadroData2018::FracADepTable(int targA) const
+{
+// Returns the pi+A fate fractions (CEx, Inelas, Abs, PiPro) for the input
+// target A at every kFracADepKEStep MeV in the hA kinetic energy range,
+// tabulated from the TGraph2Ds the first time A is queried. A job uses a few
+// nuclei only, so the slow TGraph2D interpolation is run for these only.
+// FracADep then interpolates linearly in KE at fixed A, which closely
+// follows the piecewise-linear TGraph2D interpolation along that line.
+
+  vector<double> & table = fFracPipATable[targA];
+  if(!table.empty()) return table;
+
+  TGraph2D * frac[kFracADepNFates] = {
+     TfracPipA_CEx, TfracPipA_Inelas, TfracPipA_Abs, TfracPipA_PiPro };
+
+  int nKE = 1 + TMath::Nint((fMaxKinEnergyHA - fMinKinEnergy) / kFracADepKEStep);
+
+  table.resize(kFracADepNFates*nKE);
+  for(int ifate = 0; ifate < kFracADepNFates; ifate++) {
+    for(int ike = 0; ike < nKE; ike++) {
+      double ke = fMinKinEnergy + ike * kFracADepKEStep;
+      table[ifate*nKE + ike] = frac[ifate]->Interpolate((double) targA, ke);
+    }
+  }
+
+  LOG("INukeData", pINFO)
+    << "Tabulated the pi+A fate fractions for A = " << targA;
+
+  return table;
+}
+//____________________________________________________________________________
 void INukeHadroData2018::ReadhNFile(
   string filename, double ke, int npoints, int & curr_point,
   double * costh_array, double * xsec_array, int cols)
@@ -1382,18 +1423,26 @@ double INukeHadroData2018::FracADep(int hpdgc, INukeFateHA_t fate, double ke, in
   ke = TMath::Max(fMinKinEnergy,   ke);  // ke >= 1 MeV
   ke = TMath::Min(fMaxKinEnergyHA, ke);  // ke <= 999 MeV
 
-  targA = TMath::Min(208, targA);  // A <= 208
+  targA = TMath::Min(kFracADepMaxA, targA);  // A <= 208
+  targA = TMath::Max(1, targA);
 
   LOG("INukeData", pDEBUG)  << "Querying hA cross section at ke  = " << ke << " and target " << targA;
 
   // Handle pions (currently the same cross sections are used for pi+, pi-, and pi0)
   if ( hpdgc == kPdgPiP || hpdgc == kPdgPiM || hpdgc == kPdgPi0 ) {
 
-    double frac_cex = TfracPipA_CEx->Interpolate(targA, ke);
+    const vector<double> & table = this->FracADepTable(targA);
+    int    nKE = table.size() / kFracADepNFates;
+    double u   = (ke - fMinKinEnergy) / kFracADepKEStep;
+    int    ike = TMath::Min(nKE-2, (int) u);
+    double f   = u - ike;
+    const double * t = &table[ike];
+
+    double frac_cex = (1-f)*t[0] + f*t[1];
     //double frac_elas = TfracPipA_Elas->Interpolate(targA, ke);
-    double frac_inelas = TfracPipA_Inelas->Interpolate(targA, ke);
-    double frac_abs = TfracPipA_Abs->Interpolate(targA, ke);
-    double frac_pipro = TfracPipA_PiPro->Interpolate(targA, ke);
+    double frac_inelas = (1-f)*t[nKE] + f*t[nKE+1];
+    double frac_abs = (1-f)*t[2*nKE] + f*t[2*nKE+1];
+    double frac_pipro = (1-f)*t[3*nKE] + f*t[3*nKE+1];
 
     // Protect against unitarity violation due to interpolation problems
     // by renormalizing all available fate fractions to unity.
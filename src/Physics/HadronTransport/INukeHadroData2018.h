@@ -40,10 +40,14 @@
 
 #include "Physics/HadronTransport/INukeHadroFates2018.h"
 #include "Framework/GHEP/GHepParticle.h"
+#include <vector>
+
 #include "Framework/Numerical/BLI2D.h"
 
 class TGraph2D;
 
+using std::vector;
+
 namespace genie {
 
 class Spline;
@@ -153,6 +157,8 @@ private:
 
   void LoadCrossSections(void);
 
+  const vector<double> & FracADepTable (int targA) const;
+
   void ReadhNFile(
          string filename, double ke, int npoints, int & curr_point,
          /*double * ke_array,*/ double * costh_array, double * xsec_array, int cols);
@@ -224,6 +230,8 @@ private:
   TGraph2D * TfracPipA_Abs;
   TGraph2D * TfracPipA_PiPro;
 
+  mutable vector< vector<double> > fFracPipATable; ///< pi+A fate fractions vs KE, per A, tabulated from the above TGraph2Ds on first use (see FracADepTable)
+
   BLI2DNonUnifGrid * fhN2dXSecPP_Elas;
   BLI2DNonUnifGrid * fhN2dXSecNP_Elas;
   BLI2DNonUnifGrid * fhN2dXSecPipN_Elas;
@@ -66,6 +66,7 @@
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/Conventions/Units.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
@@ -92,6 +93,38 @@ using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+// majorant tables: log-spaced hadron kinetic energy bins spanning the range of
+// the hN cross section splines, radial grid covering the tracking volume
+// (starting just off the centre, where the Coulomb potential is singular) and
+// safety factor applied to the maximum 1/mfp found on the grid
+static const int    kNMajorantKEBins = 100;
+static const int    kNMajorantRadii  = 200;
+static const double kMajorantRMin    = 0.01; // fm
+static const double kMajorantSafety  = 1.3;
+
+// mean free path tables: radial grid points (covering the tracking volume,
+// with the first one just off the centre, where the Coulomb potential is
+// singular) and log-spaced kinetic energy grid points (the hN cross section
+// spline range)
+static const int    kNMFPRadii       = 128;
+static const double kMFPRMin         = 0.01; // fm
+static const int    kNMFPKE          = 160;
+
+//___________________________________________________________________________
+static int HadronTableKey(int pdgc, int A, int Z)
+{
+// key of the tables kept for each hadron and remnant nucleus
+  int ihad  = 0;
+  if      (pdgc == kPdgPiP    ) ihad = 1;
+  else if (pdgc == kPdgPi0    ) ihad = 2;
+  else if (pdgc == kPdgPiM    ) ihad = 3;
+  else if (pdgc == kPdgProton ) ihad = 4;
+  else if (pdgc == kPdgNeutron) ihad = 5;
+  else if (pdgc == kPdgKP     ) ihad = 6;
+
+  return 1000000*ihad + 1000*A + Z;
+}
+
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018() :
 EventRecordVisitorI()
@@ -334,18 +367,24 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
        continue; // <-- skip to next GHEP entry
     }
 
-    // Start stepping particle out of the nucleus
     bool has_interacted = false;
-    while ( this-> IsInNucleus(sp) ) 
-    {
-      // advance the hadron by a step
-      utils::intranuke2018::StepParticle(sp, fHadStep);
-
-      // check whether it interacts
-      double d = this->GenerateStep(evrec,sp);
-      has_interacted = (d<fHadStep);
-      if(has_interacted) break;
-    }//stepping
+    if(fDeltaTracking && fRemnA > 0 && sp->P4()->Vect().Mag() > 0) {
+      // Sample free flights until a real collision or the exit
+      has_interacted = this->TrackDelta(sp);
+    }
+    else {
+      // Start stepping particle out of the nucleus
+      while ( this-> IsInNucleus(sp) ) 
+      {
+        // advance the hadron by a step
+        utils::intranuke2018::StepParticle(sp, fHadStep);
+
+        // check whether it interacts
+        double d = this->GenerateStep(evrec,sp);
+        has_interacted = (d<fHadStep);
+        if(has_interacted) break;
+      }//stepping
+    }
 
     //updating the position of the original particle with the position of the clone
     evrec->Particle(sp->FirstMother())->SetPosition(*(sp->X4()));
@@ -399,6 +438,26 @@ double Intranuke2018::GenerateStep(GHepRecord*  /*evrec*/, GHepParticle* p) cons
 // Computes the mean free path L and generate an 'interaction' distance d 
 // from an exp(-d/L) distribution
 
+  RandomGen * rnd = RandomGen::Instance();
+
+  LOG("Intranuke2018", pDEBUG)    << "mode= " << this->GetGenINukeMode();
+
+  double L = this->MeanFreePath(p);
+
+  double d = -1.*L * TMath::Log(rnd->RndFsi().Rndm());
+
+  /*    LOG("Intranuke2018", pDEBUG)
+    << "mode= " << fINukeMode << "; Mean free path = " << L << " fm / "
+                              << "Generated path length = " << d << " fm";
+  */
+  return d;
+}
+//___________________________________________________________________________
+double Intranuke2018::MeanFreePath(const GHepParticle* p) const
+{
+// Mean free path (in fermis) for particle p at its current position,
+// including the tweaking factors
+
   int pdgc = p->Pdg();
 
   double scale = 1.;
@@ -409,35 +468,273 @@ double Intranuke2018::GenerateStep(GHepRecord*  /*evrec*/, GHepParticle* p) cons
     scale = fNucleonMFPScale;
   }
 
-  RandomGen * rnd = RandomGen::Instance();
+  double L = (fUseMFPTable) ? this->TabulatedMeanFreePath(p) : -1.;
+  if(L <= 0) {
+    string fINukeMode = this->GetINukeMode();
+    L = utils::intranuke2018::MeanFreePath(p->Pdg(), *p->X4(), *p->P4(), fRemnA,
+						fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr, fINukeMode);
+  }
+  L *= scale;
+
+  return L;
+}
+//___________________________________________________________________________
+double Intranuke2018::TabulatedMeanFreePath(const GHepParticle* p) const
+{
+// Mean free path (in fermis, without the tweaking factors) for particle p,
+// interpolated in the 1/mfp table of the current remnant nucleus.
+// Returns -1 if the mean free path must be evaluated exactly.
+
+  if(fRemnA <= 0) return -1.;
+
+  int  pdgc    = p->Pdg();
+  bool is_pion = (pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM);
+
+  double kemin = INukeHadroData2018::fMinKinEnergy;
+  double kemax = INukeHadroData2018::fMaxKinEnergyHN;
+
+  double ke = (p->P4()->Energy() - p->P4()->M()) / units::MeV;
+  ke = TMath::Max(kemin, ke);
+  ke = TMath::Min(kemax, ke);
+
+  // the Oset model also sets the pion fate probabilities used in hN mode
+  if(is_pion && fUseOset && ke < 350. && this->GetINukeMode() == "hN2018") {
+    return -1.;
+  }
+
+  double dlnke = TMath::Log(kemax/kemin) / (kNMFPKE-1);
+
+  // in hN mode the nucleon cross sections drop to 0 below E0 = 12 MeV A^0.2:
+  // no interpolation across that step
+  bool is_nucleon = (pdgc == kPdgProton || pdgc == kPdgNeutron);
+  if(is_nucleon && this->GetINukeMode() == "hN2018") {
+    double E0 = 12. * TMath::Power(fRemnA, 0.2);
+    if(E0 > kemin && E0 < kemax &&
+       (int) (TMath::Log(ke/kemin)/dlnke) == (int) (TMath::Log(E0/kemin)/dlnke)) {
+      return -1.;
+    }
+  }
+
+  double rmax = this->MFPTableRMax();
+  double r    = p->X4()->Vect().Mag();
+  if(r >= rmax) return -1.;
+
+  const vector<double> & table = this->InvMFPTable(p);
+
+  double xr = (kNMFPRadii-1) * r / rmax;
+  double xk = TMath::Log(ke/kemin) / dlnke;
+  int    ir = TMath::Min((int) xr, kNMFPRadii-2);
+  int    ik = TMath::Min((int) xk, kNMFPKE-2);
+  double fr = xr - ir;
+  double fk = xk - ik;
+
+  const double * t = &table[ir*kNMFPKE + ik];
+  double mu = (1.-fr) * ((1.-fk) * t[0]       + fk * t[1]) +
+                  fr  * ((1.-fk) * t[kNMFPKE] + fk * t[kNMFPKE+1]);
+
+  return (mu > 0) ? 1./mu : -1.;
+}
+//___________________________________________________________________________
+double Intranuke2018::MFPTableRMax(void) const
+{
+// Outer radius of the mean free path table for the current remnant nucleus.
+// Covers the tracking radius (set from the target nucleus, with A up to
+// fRemnA+1 in lepton-nucleus events) and the last step beyond it.
+
+  return fNR * fR0 * TMath::Power(fRemnA+1, 1./3.) + 2*fHadStep;
+}
+//___________________________________________________________________________
+const vector<double> & Intranuke2018::InvMFPTable(const GHepParticle* p) const
+{
+// 1/mfp (in 1/fm) on the (r, KE) grid for particle p in the current remnant
+// nucleus, built on first use
+
+  int key = HadronTableKey(p->Pdg(), fRemnA, fRemnZ);
+
+  map<int, vector<double> >::iterator it = fInvMFPTables.find(key);
+  if(it != fInvMFPTables.end()) return it->second;
+
+  LOG("Intranuke2018", pINFO)
+     << "Building the 1/mfp table for a " << p->Name()
+     << " in (A,Z) = (" << fRemnA << ", " << fRemnZ << ")";
+
+  vector<double> table(kNMFPRadii*kNMFPKE, 0.);
 
   string fINukeMode = this->GetINukeMode();
-  string fINukeModeGen = this->GetGenINukeMode();
 
-  double L = utils::intranuke2018::MeanFreePath(p->Pdg(), *p->X4(), *p->P4(), fRemnA,
-						fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr, fINukeMode);
+  double kemin = INukeHadroData2018::fMinKinEnergy;
+  double kemax = INukeHadroData2018::fMaxKinEnergyHN;
+  double dlnke = TMath::Log(kemax/kemin) / (kNMFPKE-1);
+  double rmax  = this->MFPTableRMax();
+  double M     = p->Mass();
+
+  for(int ik = 0; ik < kNMFPKE; ik++) {
+    double ke = kemin * TMath::Exp(ik*dlnke) * units::MeV;
+    double E  = M + ke;
+    double pz = TMath::Sqrt(TMath::Max(0., E*E - M*M));
+    TLorentzVector p4(0., 0., pz, E);
+
+    for(int ir = 0; ir < kNMFPRadii; ir++) {
+      double r = TMath::Max(kMFPRMin, ir*rmax/(kNMFPRadii-1));
+      TLorentzVector x4(0., 0., r, 0.);
+      double L = utils::intranuke2018::MeanFreePath(p->Pdg(), x4, p4, fRemnA,
+                    fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr, fINukeMode);
+      table[ir*kNMFPKE + ik] = (L > 0) ? 1./L : 0.;
+    }
+  }
 
-  LOG("Intranuke2018", pDEBUG)    << "mode= " << fINukeModeGen;
-  L *= scale;
+  it = fInvMFPTables.insert(map<int, vector<double> >::value_type(key, table)).first;
+  return it->second;
+}
+//___________________________________________________________________________
+bool Intranuke2018::TrackDelta(GHepParticle* p) const
+{
+// Delta (Woodcock) tracking: flight distances are generated with the
+// majorant 1/mfp, which is constant along the straight path of the hadron,
+// and a collision at the end of a flight is real with probability
+// (1/mfp) / majorant. Otherwise (virtual collision) the hadron carries on.
+// The hadron is left at the collision point, or on the tracking boundary if
+// it escapes. Returns true if it interacts.
+// If the 1/mfp is ever found above the majorant, the flights sampled so far
+// are biased: the majorant is raised and the hadron is tracked again from
+// its starting point.
 
-  double d = -1.*L * TMath::Log(rnd->RndFsi().Rndm());
+  RandomGen * rnd = RandomGen::Instance();
 
-  /*    LOG("Intranuke2018", pDEBUG)
-    << "mode= " << fINukeMode << "; Mean free path = " << L << " fm / "
-                              << "Generated path length = " << d << " fm";
-  */
-  return d;
+  double & majorant = this->Majorant(p);
+  TLorentzVector x4start(*p->X4());
+
+  while(1) {
+    double dexit = this->DistToBoundary(p);
+    double d     = -1. * TMath::Log(rnd->RndFsi().Rndm()) / majorant;
+    if(d >= dexit) {
+      utils::intranuke2018::StepParticle(p, dexit);
+      return false;
+    }
+    utils::intranuke2018::StepParticle(p, d);
+
+    double L = this->MeanFreePath(p);
+    // a non-finite mfp forces an interaction (as in GenerateStep())
+    if(L <= 0) return true;
+
+    double mu = 1./L;
+    if(mu > majorant) {
+      LOG("Intranuke2018", pWARN)
+         << "1/mfp = " << mu << " /fm exceeds the majorant (" << majorant
+         << " /fm) for a " << p->Name() << " with kinetic E = " << p->KinE()
+         << " GeV at r = " << p->X4()->Vect().Mag() << " fm - Raising it"
+         << " and restarting the flight";
+      majorant = kMajorantSafety * mu;
+      p->SetPosition(x4start);
+      continue;
+    }
+    if(rnd->RndFsi().Rndm() * majorant < mu) return true;
+  }
+  return false;
+}
+//___________________________________________________________________________
+double Intranuke2018::DistToBoundary(const GHepParticle* p) const
+{
+// Distance (in fermis) along the hadron direction to the sphere the hadrons
+// are tracked within (see IsInNucleus())
+
+  double   R = fTrackingRadius + fHadStep;
+  TVector3 x = p->X4()->Vect();
+  TVector3 u = p->P4()->Vect().Unit();
+
+  double c = x.Mag2() - R*R;
+  if(c >= 0) return 0.;
+
+  double b = x.Dot(u);
+  return -b + TMath::Sqrt(b*b - c);
+}
+//___________________________________________________________________________
+int Intranuke2018::MajorantBin(const GHepParticle* p) const
+{
+// Kinetic energy bin of the majorant tables (the hN cross sections are
+// constant outside the spline range, see utils::intranuke2018::MeanFreePath())
+
+  double kemin = INukeHadroData2018::fMinKinEnergy;
+  double kemax = INukeHadroData2018::fMaxKinEnergyHN;
+
+  double ke = (p->P4()->Energy() - p->P4()->M()) / units::MeV;
+  ke = TMath::Max(kemin, ke);
+  ke = TMath::Min(kemax, ke);
+
+  int bin = (int) (kNMajorantKEBins * TMath::Log(ke/kemin) / TMath::Log(kemax/kemin));
+  return TMath::Min(bin, kNMajorantKEBins-1);
+}
+//___________________________________________________________________________
+double & Intranuke2018::Majorant(const GHepParticle* p) const
+{
+// Majorant 1/mfp (in 1/fm) for particle p in the current remnant nucleus.
+// For each hadron and remnant (A,Z) the table is built on first use by
+// scanning the tracking volume radially, at the edges and the centre of
+// each kinetic energy bin.
+
+  int key = HadronTableKey(p->Pdg(), fRemnA, fRemnZ);
+
+  map<int, vector<double> >::iterator it = fMajorants.find(key);
+  if(it == fMajorants.end()) {
+
+    LOG("Intranuke2018", pINFO)
+       << "Building the majorant 1/mfp table for a " << p->Name()
+       << " in (A,Z) = (" << fRemnA << ", " << fRemnZ << ")";
+
+    vector<double> majorant(kNMajorantKEBins, 0.);
+
+    double kemin = INukeHadroData2018::fMinKinEnergy;
+    double kemax = INukeHadroData2018::fMaxKinEnergyHN;
+    double dlnke = TMath::Log(kemax/kemin) / (2*kNMajorantKEBins);
+    double R     = fTrackingRadius + fHadStep;
+    // same mass as in MajorantBin()
+    double M     = p->P4()->M();
+    if(M <= 0) M = p->Mass();
+
+    GHepParticle h(*p);
+    for(int ike = 0; ike <= 2*kNMajorantKEBins; ike++) {
+      double ke = kemin * TMath::Exp(ike*dlnke) * units::MeV;
+      double E  = M + ke;
+      double pz = TMath::Sqrt(TMath::Max(0., E*E - M*M));
+      h.SetMomentum(0., 0., pz, E);
+
+      double mumax = 0.;
+      for(int ir = 0; ir <= kNMajorantRadii; ir++) {
+        double r = TMath::Max(kMajorantRMin, ir*R/kNMajorantRadii);
+        h.SetPosition(0., 0., r, 0.);
+        double L = this->MeanFreePath(&h);
+        if(L > 0) mumax = TMath::Max(mumax, 1./L);
+      }
+      // even points are bin edges, odd points bin centres
+      int bhi = ike/2;
+      int blo = (ike%2 == 0) ? bhi-1 : bhi;
+      if(blo >= 0) majorant[blo] = TMath::Max(majorant[blo], mumax);
+      if(bhi < kNMajorantKEBins && bhi != blo) {
+        majorant[bhi] = TMath::Max(majorant[bhi], mumax);
+      }
+    }
+    for(int ib = 0; ib < kNMajorantKEBins; ib++) {
+      majorant[ib] = TMath::Max(kMajorantSafety * majorant[ib], 1E-6);
+    }
+    it = fMajorants.insert(map<int, vector<double> >::value_type(key, majorant)).first;
+  }
+
+  return (it->second)[this->MajorantBin(p)];
 }
 //___________________________________________________________________________
 void Intranuke2018::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
   this->LoadConfig();
+  fMajorants.clear();
+  fInvMFPTables.clear();
 }
 //___________________________________________________________________________
 void Intranuke2018::Configure(string param_set)
 {
   Algorithm::Configure(param_set);
   this->LoadConfig();
+  fMajorants.clear();
+  fInvMFPTables.clear();
 }
 //___________________________________________________________________________
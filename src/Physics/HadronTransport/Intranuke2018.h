@@ -8,11 +8,28 @@
 
 \ref      R.Merenyi et al., Phys.Rev.D45 (1992)
           R.D.Ransome, Nucl.Phys.B 139 (2005)
+          E.R.Woodcock et al., ANL-7050 (1965) [delta tracking]
 
           Current INTRANUKE development is led by S.Dytman and H.Gallagher.
           The original INTRANUKE cascade MC was developed (in fortran) for the
           NeuGEN MC by R.Edgecock, G.F.Pearce, W.A.Mann, R.Merenyi and others.
 
+          Hadrons are moved through the nucleus in fixed steps (INUKE-HadStep)
+          and the mean free path is re-evaluated after each step. With
+          INUKE-DeltaTracking enabled, free flights are instead sampled against
+          a majorant of the inverse mean free path (tabulated in kinetic energy
+          for each hadron and remnant nucleus) and a collision at the end of a
+          flight is accepted with probability (1/mfp)/majorant (Woodcock delta
+          tracking). This samples the continuous-path limit of the stepping
+          algorithm, so the mean free path is evaluated about once per flight
+          rather than once per step.
+
+          With INUKE-MFPTable enabled (default) the mean free path is looked
+          up, with bilinear interpolation in (r, log KE), in a table of 1/mfp
+          built on first use for each hadron and remnant nucleus (A,Z).
+          Disable it to evaluate utils::intranuke2018::MeanFreePath() exactly
+          at every step.
+
 \author   Steve Dytman <dytman+@pitt.edu>, Pittsburgh University
           Aaron Meyer <asm58@pitt.edu>, Pittsburgh University
 	  Alex Bell, Pittsburgh University
@@ -30,6 +47,9 @@
 #ifndef _INTRANUKE_2018_H_
 #define _INTRANUKE_2018_H_
 
+#include <map>
+#include <vector>
+
 #include <TGenPhaseSpace.h>
 
 #include "Physics/NuclearState/NuclearModelI.h"
@@ -43,6 +63,9 @@
 class TLorentzVector;
 class TVector3;
 
+using std::map;
+using std::vector;
+
 namespace genie {
 
 class GHepParticle;
@@ -85,6 +108,18 @@ protected:
   bool   IsInNucleus        (const GHepParticle* p) const;
   void   SetTrackingRadius  (const GHepParticle* p) const;
   double GenerateStep       (GHepRecord* ev, GHepParticle* p) const;
+  double MeanFreePath       (const GHepParticle* p) const;
+
+  // mean free path tables
+  double TabulatedMeanFreePath (const GHepParticle* p) const;
+  double MFPTableRMax          (void) const;
+  const vector<double> & InvMFPTable (const GHepParticle* p) const;
+
+  // delta tracking
+  bool     TrackDelta       (GHepParticle* p) const;
+  double   DistToBoundary   (const GHepParticle* p) const;
+  int      MajorantBin      (const GHepParticle* p) const;
+  double & Majorant         (const GHepParticle* p) const;
 
   // virtual functions for individual modes
   virtual void SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p) const = 0;
@@ -100,6 +135,8 @@ protected:
   mutable int            fRemnZ;         ///< remnant nucleus Z
   mutable TLorentzVector fRemnP4;        ///< P4 of remnant system
   mutable GEvGenMode_t   fGMode;         ///< event generation mode (lepton+A, hadron+A, ...)
+  mutable map<int, vector<double> > fMajorants; ///< majorant 1/mfp (1/fm) vs KE bin, for each hadron & remnant (A,Z)
+  mutable map<int, vector<double> > fInvMFPTables; ///< 1/mfp (1/fm) vs (r, KE), for each hadron & remnant (A,Z)
 
   // configuration parameters
   double       fR0;           ///< effective nuclear size param
@@ -108,6 +145,8 @@ protected:
   double       fDelRPion;     ///< factor by which Pion Compton wavelength gets multiplied to become nuclear size enhancement 
   double       fDelRNucleon;  ///< factor by which Nucleon Compton wavelength gets multiplied to become nuclear size enhancement 
   double       fHadStep;      ///< step size for intranuclear hadron transport
+  bool         fDeltaTracking; ///< sample free flights against a majorant mfp, instead of stepping
+  bool         fUseMFPTable;   ///< look-up the mfp in (r, KE) tables rather than evaluating it exactly
   double       fNucAbsFac;    ///< absorption xsec correction factor (hN Mode)
   double       fNucCEXFac;    ///< charge exchange xsec correction factor (hN Mode)
   double       fEPreEq;       ///< threshold for pre-equilibrium reaction
@@ -45,6 +45,7 @@
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGCodeList.h"
@@ -66,6 +67,8 @@ EventRecordVisitorI("genie::AGKYLowW2019")
 {
   fBaryonXFpdf  = 0;
   fBaryonPT2pdf = 0;
+  fMultCDFMax   = 0;
+  fMultCDFW     = -1;
 //fKNO          = 0;
 }
 //____________________________________________________________________________
@@ -74,6 +77,8 @@ EventRecordVisitorI("genie::AGKYLowW2019", config)
 {
   fBaryonXFpdf  = 0;
   fBaryonPT2pdf = 0;
+  fMultCDFMax   = 0;
+  fMultCDFW     = -1;
 //fKNO          = 0;
 }
 //____________________________________________________________________________
@@ -260,18 +265,7 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
    //-- Build the multiplicity probabilities for the input interaction
   LOG("KNOHad", pDEBUG) << "Building Multiplicity Probability distribution";
   LOG("KNOHad", pDEBUG) << *interaction;
-  Option_t * opt = "+LowMultSuppr+Renormalize";
-  TH1D * mprob = this->MultiplicityProb(interaction,opt);
-
-  if(!mprob) {
-    LOG("KNOHad", pWARN) << "Null multiplicity probability distribution!";
-    return 0;
-  }
-  if(mprob->Integral("width")<=0) {
-    LOG("KNOHad", pWARN) << "Empty multiplicity probability distribution!";
-    delete mprob;
-    return 0;
-  }
+  if(!this->BuildMultiplicityCDF(interaction)) return 0;
 
   //----- FIND AN ALLOWED SOLUTION FOR THE HADRONIC FINAL STATE
 
@@ -287,12 +281,11 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
        LOG("KNOHad", pERROR)
          << "Couldn't select hadronic shower particles after: "
          << itry << " attempts!";
-       delete mprob;
        return 0;
     }
 
     //-- Generate a hadronic multiplicity
-    mult = TMath::Nint( mprob->GetRandom() );
+    mult = this->GenerateMultiplicity();
 
     LOG("KNOHad", pINFO) << "Hadron multiplicity  = " << mult;
 
@@ -317,7 +310,6 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
       } else {
         LOG("KNOHad", pWARN)
            << "Generated multiplicity: " << mult << " is too low! Quitting";
-        delete mprob;
         return 0;
       }
     }
@@ -361,8 +353,6 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
 
   } // attempts
 
-  delete mprob;
-
   return pdgcv;
 }
 //____________________________________________________________________________
@@ -381,6 +371,29 @@ TH1D * AGKYLowW2019::MultiplicityProb(
 //    section reduction factor then the output histogram should not be re-
 //    normalized after applying the scaling factors.
 
+  double prob[kMaxPSMultiplicity+1];
+  int maxmult = this->MultiplicityProb(interaction, opt, prob);
+  if(maxmult < 2) return 0;
+
+  // Create multiplicity probability histogram
+  TH1D * mult_prob = this->CreateMultProbHist(maxmult);
+
+  for(int n = 2; n <= maxmult; n++) {
+     mult_prob->Fill(n, prob[n]);
+  }
+
+  return mult_prob;
+}
+//____________________________________________________________________________
+int AGKYLowW2019::MultiplicityProb(
+     const Interaction * interaction, Option_t * opt, double * prob) const
+{
+// Computes the multiplicity probabilities prob[n], n = 0,...,kMaxPSMultiplicity
+// (see the TH1D version above for the options) without any allocation.
+// Returns the maximum multiplicity, or 0 if no distribution can be built.
+
+  for(int n = 0; n <= kMaxPSMultiplicity; n++) prob[n] = 0;
+
   if(!this->AssertValidity(interaction)) {
      LOG("KNOHad", pWARN)
        << "Returning a null multiplicity probability distribution!";
@@ -411,7 +424,7 @@ TH1D * AGKYLowW2019::MultiplicityProb(
   // Set maximum multiplicity so that it does not exceed the max number of
   // particles accepted by the ROOT phase space decayer (18)
   // Change this if ROOT authors remove the TGenPhaseSpace limitation.
-  if(maxmult>18) maxmult=18;
+  if(maxmult>kMaxPSMultiplicity) maxmult=kMaxPSMultiplicity;
 
   SLOG("KNOHad", pDEBUG) << "Computed maximum multiplicity = " << maxmult;
 
@@ -419,19 +432,14 @@ TH1D * AGKYLowW2019::MultiplicityProb(
      LOG("KNOHad", pWARN) << "Low maximum multiplicity! Quiting.";
      return 0;
   }
+  int nmax = TMath::Nint(maxmult);
 
-  // Create multiplicity probability histogram
-  TH1D * mult_prob = this->CreateMultProbHist(maxmult);
-
-  // Compute the multiplicity probabilities values up to the bin corresponding
-  // to the computed maximum multiplicity
-
-  if(maxmult>2) {
-    int nbins = mult_prob->FindBin(maxmult);
+  // Compute the multiplicity probabilities values up to the computed
+  // maximum multiplicity
 
-    for(int i = 1; i <= nbins; i++) {
+  if(nmax>2) {
+    for(int n = 2; n <= nmax; n++) {
        // KNO distribution is <n>*P(n) vs n/<n>
-       double n    = mult_prob->GetBinCenter(i);  // bin centre
        double z    = n/avn;                       // z=n/<n>
        double avnP = this->KNO(nu_pdg,nuc_pdg,z); // <n>*P(n)
        double P    = avnP / avn;                  // P(n)
@@ -440,20 +448,21 @@ TH1D * AGKYLowW2019::MultiplicityProb(
           << "n = " << n << " (n/<n> = " << z
           << ", <n>*P = " << avnP << ") => P = " << P;
 
-       mult_prob->Fill(n,P);
+       prob[n] = P;
     }
   } else {
        SLOG("KNOHad", pDEBUG) << "Fixing multiplicity to 2";
-       mult_prob->Fill(2,1.);
+       prob[2] = 1.;
   }
 
-  double integral = mult_prob->Integral("width");
+  double integral = 0;
+  for(int n = 2; n <= nmax; n++) integral += prob[n];
   if(integral>0) {
     // Normalize the probability distribution
-    mult_prob->Scale(1.0/integral);
+    for(int n = 2; n <= nmax; n++) prob[n] /= integral;
   } else {
     SLOG("KNOHad", pWARN) << "probability distribution integral = 0";
-    return mult_prob;
+    return nmax;
   }
 
   string option(opt);
@@ -466,7 +475,7 @@ TH1D * AGKYLowW2019::MultiplicityProb(
     SLOG("KNOHad", pINFO) << "Applying NeuGEN scaling factors";
      // Only do so for W<Wcut
      if(W<fWcut) {
-       this->ApplyRijk(interaction, renormalize, mult_prob);
+       this->ApplyRijk(interaction, renormalize, prob);
      } else {
         SLOG("KNOHad", pDEBUG)
               << "W = " << W << " < Wcut = " << fWcut
@@ -474,7 +483,69 @@ TH1D * AGKYLowW2019::MultiplicityProb(
      }//<wcut?
   }//apply?
 
-  return mult_prob;
+  return nmax;
+}
+//____________________________________________________________________________
+bool AGKYLowW2019::BuildMultiplicityCDF(const Interaction * interaction) const
+{
+// Builds the cumulative multiplicity distribution used by
+// GenerateMultiplicity(), unless it is already cached for the same initial
+// state, interaction type and W
+
+  if(!this->AssertValidity(interaction)) {
+     LOG("KNOHad", pWARN) << "Can not build a multiplicity distribution!";
+     return false;
+  }
+
+  const InitialState & init_state = interaction->InitState();
+  int    probe   = init_state.ProbePdg();
+  int    hit_nuc = init_state.Tgt().HitNucPdg();
+  int    itype   = (int) interaction->ProcInfo().InteractionTypeId();
+  double W       = utils::kinematics::W(interaction);
+
+  bool cached = (W       == fMultCDFW      &&
+                 probe   == fMultCDFProbe  &&
+                 hit_nuc == fMultCDFHitNuc &&
+                 itype   == fMultCDFIntType);
+
+  if(!cached) {
+    double prob[kMaxPSMultiplicity+1];
+    fMultCDFMax = this->MultiplicityProb(
+                          interaction, "+LowMultSuppr+Renormalize", prob);
+    double sum = 0;
+    for(int n = 0; n <= kMaxPSMultiplicity; n++) {
+      sum += prob[n];
+      fMultCDF[n] = sum;
+    }
+    fMultCDFW       = W;
+    fMultCDFProbe   = probe;
+    fMultCDFHitNuc  = hit_nuc;
+    fMultCDFIntType = itype;
+  }
+
+  if(fMultCDFMax < 2) {
+    LOG("KNOHad", pWARN) << "Null multiplicity probability distribution!";
+    return false;
+  }
+  if(fMultCDF[kMaxPSMultiplicity] <= 0) {
+    LOG("KNOHad", pWARN) << "Empty multiplicity probability distribution!";
+    return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+int AGKYLowW2019::GenerateMultiplicity(void) const
+{
+// Generates a hadronic multiplicity from the cached cumulative distribution
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double x = fMultCDF[kMaxPSMultiplicity] * rnd->RndHadro().Rndm();
+
+  int n = 0;
+  while(n < fMultCDFMax && fMultCDF[n] <= x) n++;
+
+  return n;
 }
 //____________________________________________________________________________
 double AGKYLowW2019::Weight(void) const
@@ -500,6 +571,10 @@ void AGKYLowW2019::Configure(string config)
 //____________________________________________________________________________
 void AGKYLowW2019::LoadConfig(void)
 {
+  // invalidate the cached multiplicity distribution
+  fMultCDFMax = 0;
+  fMultCDFW   = -1;
+
   // Force decays of unstable hadronization products?
   //GetParamDef( "ForceDecays", fForceDecays, false ) ;
 
@@ -963,8 +1038,14 @@ bool AGKYLowW2019::PhaseSpaceDecay(
   LOG("KNOHad", pINFO)
     << "Decaying system p4 = " << utils::print::P4AsString(&pd);
 
-  // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(pd, pdgv.size(), mass);
+  // Set the decay, with the daughters in the canonical order of the
+  // maximum weight tables (see NBodyPhaseSpace)
+  int nd = pdgv.size();
+  vector<double> smass(nd);
+  vector<int>    index(nd);
+  NBodyPhaseSpace::SortMasses(nd, mass, &smass[0], &index[0]);
+
+  bool permitted = fPhaseSpaceGenerator.SetDecay(pd, nd, &smass[0]);
   if(!permitted) {
      LOG("KNOHad", pERROR)
        << " *** Phase space decay is not permitted \n"
@@ -976,13 +1057,26 @@ bool AGKYLowW2019::PhaseSpaceDecay(
      return false;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
+  // Get the maximum weight.
+  // The phase space weight maximum is tabulated (see NBodyPhaseSpace).
+  // The pT reweighting factor is a product of exp(-A*pT) terms, so it never
+  // exceeds 1 for A >= 0 and the phase space maximum bounds the reweighted
+  // weight too. Weighted decays are normalized to the sampled maximum, with
+  // no margin.
+  NBodyPhaseSpace * psmax = NBodyPhaseSpace::Instance();
+  bool tabulated = !(reweight && fPhSpRwA < 0);
   double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     if(reweight) { w *= this->ReWeightPt2(pdgv); }
-     wmax = TMath::Max(wmax,w);
+  if(!tabulated) {
+    // no bound: estimate the maximum from warm-up decays
+    for(int idec=0; idec<200; idec++) {
+       double w = fPhaseSpaceGenerator.Generate();
+       w *= this->ReWeightPt2(pdgv);
+       wmax = TMath::Max(wmax,w);
+    }
+  } else if(fGenerateWeighted) {
+    wmax = psmax->SampledWeightMax(pd.M(), nd, &smass[0]);
+  } else {
+    wmax = psmax->WeightMax(pd.M(), nd, &smass[0]);
   }
   assert(wmax>0);
 
@@ -1003,7 +1097,7 @@ bool AGKYLowW2019::PhaseSpaceDecay(
   else
   {
     // *** generating un-weighted decays ***
-     wmax *= 2.3;
+     if(!tabulated) { wmax *= 2.3; }
      bool accept_decay=false;
      unsigned int itry=0;
 
@@ -1020,11 +1114,14 @@ bool AGKYLowW2019::PhaseSpaceDecay(
          return false;
        }
 
-       double w  = fPhaseSpaceGenerator.Generate();
+       double wps = fPhaseSpaceGenerator.Generate();
+       double w   = wps;
        if(reweight) { w *= this->ReWeightPt2(pdgv); }
        if(w > wmax) {
           LOG("KNOHad", pWARN)
            << "Decay weight = " << w << " > max decay weight = " << wmax;
+          // the table holds phase space weights
+          if(tabulated) { psmax->RaiseWeightMax(pd.M(), nd, &smass[0], wps); }
        }
        double gw = wmax * rnd->RndHadro().Rndm();
        accept_decay = (gw<=w);
@@ -1052,7 +1149,7 @@ bool AGKYLowW2019::PhaseSpaceDecay(
      int pdgc = *pdg_iter;
 
      //-- get the 4-momentum of the i-th final state particle
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(i);
+     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(index[i]);
 
      new ( plist[offset+i] ) GHepParticle(
            pdgc,                 /* PDG Code                         */
@@ -1565,11 +1662,11 @@ TH1D * AGKYLowW2019::CreateMultProbHist(double maxmult) const
 }
 //____________________________________________________________________________
 void AGKYLowW2019::ApplyRijk( const Interaction * interaction,
-                                  bool norm, TH1D * mp ) const
+                                  bool norm, double * prob ) const
 {
   // Apply the NEUGEN multiplicity probability scaling factors
   //
-  if(!mp) return;
+  if(!prob) return;
 
   const InitialState & init_state = interaction->InitState();
   int probe_pdg = init_state.ProbePdg();
@@ -1649,29 +1746,22 @@ void AGKYLowW2019::ApplyRijk( const Interaction * interaction,
   // Apply to the multiplicity probability distribution
   //
 
-  int nbins = mp->GetNbinsX();
-  for(int i = 1; i <= nbins; i++) {
-    int n = TMath::Nint( mp->GetBinCenter(i) );
-
-    double R=1;
-    if      (n==2) R=R2;
-    else if (n==3) R=R3;
-
-    if(n==2 || n==3) {
-      double P   = mp->GetBinContent(i);
-      double Psc = R*P;
-      LOG("Hadronization", pDEBUG)
-	<< "n=" << n << "/ Scaling factor R = "
-	<< R << "/ P " << P << " --> " << Psc;
-      mp->SetBinContent(i, Psc);
-    }
-    if(n>3) break;
-  }
+  double Psc2 = R2*prob[2];
+  double Psc3 = R3*prob[3];
+  LOG("Hadronization", pDEBUG)
+     << "n=2/ Scaling factor R = " << R2 << "/ P " << prob[2] << " --> " << Psc2;
+  LOG("Hadronization", pDEBUG)
+     << "n=3/ Scaling factor R = " << R3 << "/ P " << prob[3] << " --> " << Psc3;
+  prob[2] = Psc2;
+  prob[3] = Psc3;
 
-  // renormalize the histogram?
+  // renormalize the distribution?
   if(norm) {
-    double histo_norm = mp->Integral("width");
-    if(histo_norm>0) mp->Scale(1.0/histo_norm);
+    double sum = 0;
+    for(int n = 0; n <= kMaxPSMultiplicity; n++) sum += prob[n];
+    if(sum>0) {
+      for(int n = 0; n <= kMaxPSMultiplicity; n++) prob[n] /= sum;
+    }
   }
 }
 //____________________________________________________________________________
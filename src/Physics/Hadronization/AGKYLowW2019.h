@@ -81,6 +81,9 @@ private:
   double         Weight                (void)                                        const;
   PDGCodeList *  SelectParticles       (const Interaction*)                          const;
   TH1D *         MultiplicityProb      (const Interaction*, Option_t* opt = "")      const;
+  int            MultiplicityProb      (const Interaction*, Option_t* opt, double * prob) const;
+  bool           BuildMultiplicityCDF  (const Interaction*)                          const;
+  int            GenerateMultiplicity  (void)                                        const;
   bool           AssertValidity        (const Interaction * i)                       const;
   PDGCodeList *  GenerateHadronCodes   (int mult, int maxQ, double W)                const;
   int            GenerateBaryonPdgCode (int mult, int maxQ, double W)                const;
@@ -91,7 +94,7 @@ private:
   double         ReWeightPt2           (const PDGCodeList & pdgcv)                   const;
   double         MaxMult               (const Interaction * i)                       const;
   TH1D *         CreateMultProbHist    (double maxmult)                              const;
-  void           ApplyRijk             (const Interaction * i, bool norm, TH1D * mp) const;
+  void           ApplyRijk             (const Interaction * i, bool norm, double * prob) const;
   double         Wmin                  (void)                                        const;
 
   TClonesArray* DecayMethod1    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
@@ -105,6 +108,18 @@ private:
   mutable TGenPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
   mutable double         fWeight;              ///< weight for generated event
 
+  // Multiplicity CDF of the last hadronized initial state & W
+  // (reused while retrying, and by the next event if it has the same key)
+
+  static const int kMaxPSMultiplicity = 18; ///< max multiplicity accepted by the phase space decayer
+
+  mutable double         fMultCDF[kMaxPSMultiplicity+1]; ///< cumulative multiplicity probabilities
+  mutable int            fMultCDFMax;          ///< max multiplicity in the cached CDF (0: empty)
+  mutable double         fMultCDFW;            ///< CDF key: hadronic invariant mass
+  mutable int            fMultCDFProbe;        ///< CDF key: probe PDG code
+  mutable int            fMultCDFHitNuc;       ///< CDF key: hit nucleon PDG code
+  mutable int            fMultCDFIntType;      ///< CDF key: interaction type
+
   // Configuration parameters
   // Note: additional configuration parameters common to all hadronizers
   // (Wcut,Rijk,...) are declared one layer down in the inheritance tree
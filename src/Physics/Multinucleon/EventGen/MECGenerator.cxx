@@ -33,6 +33,7 @@
 #include "Physics/NuclearState/NuclearModelI.h"
 //#include "Physics/Multinucleon/XSection/MECHadronTensor.h"
 #include "Physics/HadronTensors/HadronTensorI.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -490,13 +491,9 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
   }
 
   // Get the maximum weight
-  double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
+  NBodyPhaseSpace * psmax = NBodyPhaseSpace::Instance();
+  double wmax = psmax->WeightMax(p4d->M(), pdgv.size(), mass);
   assert(wmax>0);
-  wmax *= 2;
 
   LOG("MEC", pNOTICE)
      << "Max phase space gen. weight = " << wmax;
@@ -529,6 +526,7 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
      if(w > wmax) {
         LOG("MEC", pWARN)
            << "Decay weight = " << w << " > max decay weight = " << wmax;
+        psmax->RaiseWeightMax(p4d->M(), pdgv.size(), mass, w);
      }
      double gw = wmax * rnd->RndDec().Rndm();
      accept_decay = (gw<=w);
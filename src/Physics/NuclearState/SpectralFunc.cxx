@@ -15,9 +15,11 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+#include <cstdlib>
+
 #include <TSystem.h>
 #include <TNtupleD.h>
-#include <TGraph2D.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
@@ -26,6 +28,7 @@
 #include "Physics/NuclearState/SpectralFunc.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/BLI2D.h"
 
 using namespace genie;
 using namespace genie::constants;
@@ -48,13 +51,12 @@ NuclearModelI("genie::SpectralFunc", config)
 //____________________________________________________________________________
 SpectralFunc::~SpectralFunc()
 {
-//if (fSfFe56) delete fSfFe56;
-//if (fSfC12 ) delete fSfC12;
+  this->DeleteTables();
 }
 //____________________________________________________________________________
 bool SpectralFunc::GenerateNucleon(const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
+  SFTable * sf = this->SelectSpectralFunction(target);
 
   if(!sf) {
     fCurrRemovalEnergy = 0.;
@@ -62,71 +64,83 @@ bool SpectralFunc::GenerateNucleon(const Target & target) const
     return false;
   }
 
-  double kmin    = sf->GetXmin(); // momentum range
-  double kmax    = sf->GetXmax();
-  double wmin    = sf->GetYmin(); // removal energy range
-  double wmax    = sf->GetYmax();
-  double probmax = sf->GetZmax(); // maximum probability
-  probmax *= 1.1;
-
-  double dk = kmax - kmin;
-  double dw = wmax - wmin;
+  int nk = sf->fNK;
+  int nw = sf->fNW;
 
-  LOG("SpectralFunc", pINFO) << "Momentum range = ["   << kmin << ", " << kmax << "]"; 
-  LOG("SpectralFunc", pINFO) << "Rmv energy range = [" << wmin << ", " << wmax << "]";
+  LOG("SpectralFunc", pINFO)
+     << "Momentum range = ["   << sf->fK[0] << ", " << sf->fK[nk-1] << "]";
+  LOG("SpectralFunc", pINFO)
+     << "Rmv energy range = [" << sf->fW[0] << ", " << sf->fW[nw-1] << "]";
 
   RandomGen * rnd = RandomGen::Instance();
 
-  unsigned int niter = 0;
-  while(1) {
-    if(niter > kRjMaxIterations) {
-       LOG("SpectralFunc", pWARN) 
-           << "Couldn't generate a hit nucleon after " << niter << " iterations";
-       return false;
-    }
-    niter++;
-
-    // random pair
-    double kc = kmin + dk * rnd->RndGen().Rndm();
-    double wc = wmin + dw * rnd->RndGen().Rndm();
-    LOG("SpectralFunc", pINFO) << "Trying p = " << kc << ", w = " << wc;
-
-    // accept/reject
-    double prob  = this->Prob(kc,wc, target);
-    double probg = probmax * rnd->RndGen().Rndm();
-    bool accept = (probg < prob);
-    if(!accept) continue;
-
-    LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
-    LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
-
-    // generate momentum components
-    double costheta = -1. + 2. * rnd->RndGen().Rndm();
-    double sintheta = TMath::Sqrt(1.-costheta*costheta);
-    double fi       = 2 * kPi * rnd->RndGen().Rndm();
-    double cosfi    = TMath::Cos(fi);
-    double sinfi    = TMath::Sin(fi);
-
-    double kx = kc*sintheta*cosfi;
-    double ky = kc*sintheta*sinfi;
-    double kz = kc*costheta;
-
-    // set generated values
-    fCurrRemovalEnergy = wc;
-    fCurrMomentum.SetXYZ(kx,ky,kz);
-
-    return true;
-  }
-  return false;
+  // Momentum: pick a momentum cell and then a momentum within the cell.
+  // The bilinear interpolation integrated over w is linear within the cell
+  int    ik  = SampleCell(&sf->fKCDF[0], nk-1, rnd->RndGen().Rndm());
+  double pk0 = sf->fKInt[ik];
+  double pk1 = sf->fKInt[ik+1];
+  double tk  = SampleLinear(pk0, pk1, rnd->RndGen().Rndm());
+  double kc  = sf->fK[ik] + tk * (sf->fK[ik+1] - sf->fK[ik]);
+
+  // Removal energy: at the selected momentum, the distribution in w is
+  // a mixture of the ones at the two nearby momentum grid points
+  double wk0 = (1.-tk) * pk0;
+  double wk1 =     tk  * pk1;
+  int    jk  = ((wk0 + wk1) * rnd->RndGen().Rndm() < wk0) ? ik : ik+1;
+  int    iw  = SampleCell(&sf->fWCDF[jk*(nw-1)], nw-1, rnd->RndGen().Rndm());
+  double tw  = SampleLinear(
+     sf->fProb[jk*nw+iw], sf->fProb[jk*nw+iw+1], rnd->RndGen().Rndm());
+  double wc  = sf->fW[iw] + tw * (sf->fW[iw+1] - sf->fW[iw]);
+
+  LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc;
+  LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
+
+  // generate momentum components
+  double costheta = -1. + 2. * rnd->RndGen().Rndm();
+  double sintheta = TMath::Sqrt(1.-costheta*costheta);
+  double fi       = 2 * kPi * rnd->RndGen().Rndm();
+  double cosfi    = TMath::Cos(fi);
+  double sinfi    = TMath::Sin(fi);
+
+  double kx = kc*sintheta*cosfi;
+  double ky = kc*sintheta*sinfi;
+  double kz = kc*costheta;
+
+  // set generated values
+  fCurrRemovalEnergy = wc;
+  fCurrMomentum.SetXYZ(kx,ky,kz);
+
+  return true;
 }
 //____________________________________________________________________________
 double SpectralFunc::Prob(
                          double p, double w, const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
+  SFTable * sf = this->SelectSpectralFunction(target);
   if(!sf) return 0;
 
-  return sf->Interpolate(p,w);
+  return sf->fGrid->Evaluate(p,w);
+}
+//____________________________________________________________________________
+int SpectralFunc::SampleCell(const double * cdf, int ncells, double r)
+{
+// Selects a cell given the cumulative integrals over the cells and a
+// uniform random number in [0,1]
+
+  const double * sel = std::upper_bound(cdf, cdf+ncells, r * cdf[ncells-1]);
+  int icell = sel - cdf;
+  return TMath::Min(icell, ncells-1);
+}
+//____________________________________________________________________________
+double SpectralFunc::SampleLinear(double y0, double y1, double r)
+{
+// Inverse CDF of a density varying linearly from y0 to y1 over [0,1],
+// for a uniform random number r in [0,1]:
+// solves y0*t + (y1-y0)*t^2/2 = r*(y0+y1)/2 (avoiding the y0=y1 division)
+
+  double denom = y0 + TMath::Sqrt(TMath::Max(0., y0*y0 + r*(y1*y1-y0*y0)));
+  if(denom <= 0.) return r;
+  return TMath::Min(1., r*(y0+y1)/denom);
 }
 //____________________________________________________________________________
 void SpectralFunc::Configure(const Registry & config)
@@ -163,20 +177,15 @@ void SpectralFunc::LoadConfig(void)
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_fe56.GetEntries() << " Fe56 points";
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_c12.GetEntries()  << " C12 points";
 
-  if (fSfFe56) delete fSfFe56;
-  if (fSfC12 ) delete fSfC12;
+  this->DeleteTables();
 
-  fSfFe56 = this->Convert2Graph(sfdata_fe56);
-  fSfC12  = this->Convert2Graph(sfdata_c12);
-
-  fSfFe56->SetName("sf_fe56");
-  fSfC12 ->SetName("sf_c12");
+  fSfFe56 = this->Convert2Table(sfdata_fe56);
+  fSfC12  = this->Convert2Table(sfdata_c12);
 }
 //____________________________________________________________________________
-TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
+SpectralFunc::SFTable * SpectralFunc::Convert2Table(TNtupleD & sfdata) const
 {
   int np = sfdata.GetEntries();
-  TGraph2D * sfgraph = new TGraph2D(np);
 
   sfdata.Draw("k:e:prob","","GOFF");
   assert(np==sfdata.GetSelectedRows());
@@ -184,18 +193,94 @@ TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
   double * e = sfdata.GetV2();
   double * p = sfdata.GetV3();
 
+  // the grid points
+  SFTable * sf = new SFTable;
+  for(int i=0; i<np; i++) {
+    sf->fK.push_back(k[i] * (units::MeV/units::GeV)); // momentum
+    sf->fW.push_back(e[i] * (units::MeV/units::GeV)); // removal energy
+  }
+  std::sort(sf->fK.begin(), sf->fK.end());
+  std::sort(sf->fW.begin(), sf->fW.end());
+  sf->fK.erase(std::unique(sf->fK.begin(), sf->fK.end()), sf->fK.end());
+  sf->fW.erase(std::unique(sf->fW.begin(), sf->fW.end()), sf->fW.end());
+  int nk = sf->fNK = sf->fK.size();
+  int nw = sf->fNW = sf->fW.size();
+
+  double kmin = sf->fK[0];
+  double kmax = sf->fK[nk-1];
+  double wmin = sf->fW[0];
+  double wmax = sf->fW[nw-1];
+  double dk   = (kmax-kmin)/(nk-1);
+  double dw   = (wmax-wmin)/(nw-1);
+
+  bool regular = (nk > 1 && nw > 1 && np == nk*nw);
+  for(int ik=0; regular && ik<nk; ik++) {
+    regular = TMath::Abs(sf->fK[ik] - (kmin + ik*dk)) < 1E-6*dk;
+  }
+  for(int iw=0; regular && iw<nw; iw++) {
+    regular = TMath::Abs(sf->fW[iw] - (wmin + iw*dw)) < 1E-6*dw;
+  }
+  if(!regular) {
+    LOG("SpectralFunc", pFATAL)
+      << "The spectral function data are not on a regular (k,e) grid";
+    exit(1);
+  }
+
+  // the probabilities
+  sf->fProb.resize(nk*nw, 0.);
+  sf->fGrid = new BLI2DUnifGrid(nk, kmin, kmax, nw, wmin, wmax);
   for(int i=0; i<np; i++) {
     double ki = k[i] * (units::MeV/units::GeV); // momentum
     double ei = e[i] * (units::MeV/units::GeV); // removal energy
     double pi = p[i] * TMath::Power(ki,2);      // probabillity
-    sfgraph->SetPoint(i, ki,ei,pi);
+    pi = TMath::Max(0., pi);
+    int ik = TMath::Nint((ki-kmin)/dk);
+    int iw = TMath::Nint((ei-wmin)/dw);
+    sf->fProb[ik*nw+iw] = pi;
+    sf->fGrid->AddPoint(ki, ei, pi);
+  }
+
+  // the cumulative distributions (the interpolated probability is linear
+  // in w between the grid points, and so is its integral over w in k)
+  sf->fKInt.resize(nk, 0.);
+  sf->fWCDF.resize(nk*(nw-1), 0.);
+  for(int ik=0; ik<nk; ik++) {
+    double sum = 0.;
+    for(int iw=0; iw<nw-1; iw++) {
+      sum += 0.5 * (sf->fProb[ik*nw+iw] + sf->fProb[ik*nw+iw+1]) * dw;
+      sf->fWCDF[ik*(nw-1)+iw] = sum;
+    }
+    sf->fKInt[ik] = sum;
+  }
+  sf->fKCDF.resize(nk-1, 0.);
+  double sum = 0.;
+  for(int ik=0; ik<nk-1; ik++) {
+    sum += 0.5 * (sf->fKInt[ik] + sf->fKInt[ik+1]) * dk;
+    sf->fKCDF[ik] = sum;
+  }
+
+  LOG("SpectralFunc", pDEBUG)
+    << "Tabulated spectral function on a " << nk << " x " << nw << " grid";
+
+  return sf;
+}
+//____________________________________________________________________________
+void SpectralFunc::DeleteTables(void)
+{
+  SFTable * tables[2] = { fSfFe56, fSfC12 };
+  for(int i=0; i<2; i++) {
+    if(!tables[i]) continue;
+    delete tables[i]->fGrid;
+    delete tables[i];
   }
-  return sfgraph;
+  fSfFe56 = 0;
+  fSfC12  = 0;
 }
 //____________________________________________________________________________
-TGraph2D * SpectralFunc::SelectSpectralFunction(const Target & t) const
+SpectralFunc::SFTable * SpectralFunc::SelectSpectralFunction(
+  const Target & t) const
 {
-  TGraph2D * sf = 0;
+  SFTable * sf = 0;
   int pdgc = t.Pdg();
 
   if      (pdgc == kPdgTgtC12)  sf = fSfC12;
@@ -6,6 +6,12 @@
 \brief    A realistic spectral function - based nuclear model.
           Is a concrete implementation of the NuclearModelI interface.
 
+          The spectral functions are tabulated on their (momentum, removal
+          energy) grid and bilinearly interpolated. Nucleons are generated
+          directly from the interpolated distribution (no rejection), using
+          the cumulative distribution in momentum and the cumulative
+          distributions in removal energy at each momentum grid point.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -21,13 +27,18 @@
 #ifndef _SPECTRAL_FUNCTION_H_
 #define _SPECTRAL_FUNCTION_H_
 
+#include <vector>
+
 #include "Physics/NuclearState/NuclearModelI.h"
 
+using std::vector;
+
 class TNtupleD;
-class TGraph2D;
 
 namespace genie {
 
+class BLI2DUnifGrid;
+
 class SpectralFunc : public NuclearModelI {
 
 public:
@@ -55,12 +66,30 @@ public:
   void       LoadConfig             (void);
 
 private:
-  
-  TGraph2D * Convert2Graph          (TNtupleD & data) const;
-  TGraph2D * SelectSpectralFunction (const Target & target) const; 
 
-  TGraph2D * fSfFe56;   ///< Benhar's Fe56 SF
-  TGraph2D * fSfC12;    ///< Benhar's C12 SF
+  //! A spectral function tabulated on a regular (momentum, removal energy)
+  //! grid, along with the cumulative distributions used for sampling it
+  struct SFTable {
+    int             fNK;    ///< number of momentum grid points
+    int             fNW;    ///< number of removal energy grid points
+    vector<double>  fK;     ///< momentum grid points
+    vector<double>  fW;     ///< removal energy grid points
+    vector<double>  fProb;  ///< probability (incl. the p^2 factor) at [ik*fNW+iw]
+    vector<double>  fKInt;  ///< integral of the probability over w, at each momentum grid point
+    vector<double>  fKCDF;  ///< cumulative integral over the momentum cells
+    vector<double>  fWCDF;  ///< cumulative integral over the removal energy cells, at [ik*(fNW-1)+iw]
+    BLI2DUnifGrid * fGrid;  ///< bilinear interpolation of fProb
+  };
+
+  SFTable * Convert2Table          (TNtupleD & data) const;
+  SFTable * SelectSpectralFunction (const Target & target) const;
+  void      DeleteTables           (void);
+
+  static int    SampleCell   (const double * cdf, int ncells, double r);
+  static double SampleLinear (double y0, double y1, double r);
+
+  SFTable * fSfFe56;   ///< Benhar's Fe56 SF
+  SFTable * fSfC12;    ///< Benhar's C12 SF
 };
 
 }      // genie namespace
@@ -7,6 +7,15 @@
           interaction events.
           Is a concrete implementation of the EventRecordVisitorI interface.
 
+          The adaptive envelope of KineGeneratorWithCache is not supported
+          (EnvelopeNDim() is 0): each rejection trial samples a new hit
+          nucleon from the nuclear model, and the position of the xsec peak
+          in (cos(theta_0), phi_0) moves with the nucleon momentum. A cell
+          height would have to bound the xsec over all nucleons, which the
+          envelope build, evaluating one interaction, can not provide. The
+          flat maximum is computed for the nucleon giving the largest xsec
+          (see ComputeMaxXSec()), so it stays a bound.
+
 \author   Andrew Furmanski
 
 \created  August 04, 2014
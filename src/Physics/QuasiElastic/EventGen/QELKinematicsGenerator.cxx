@@ -27,6 +27,7 @@
 #include "Physics/QuasiElastic/EventGen/QELKinematicsGenerator.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Physics/Common/KineEnvelope.h"
 
 using namespace genie;
 using namespace genie::controls;
@@ -102,8 +103,12 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space the max xsec is irrelevant.
+  //   If an adaptive envelope is used, the max xsec is the envelope height
+  //   at the generated kinematics
+  KineEnvelope * envelope = this->Envelope(evrec);
+  double xsec_max =
+     (fGenerateUniformly || envelope) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid Q2 using the rejection method
 
@@ -139,7 +144,13 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
          gQ2  = utils::kinematics::QD2toQ2(gQD2);
      }
 */
-     gQ2 = Q2min + (Q2max-Q2min) * rnd->RndKine().Rndm();
+     double u[1];
+     if(envelope) {
+       xsec_max = envelope->Generate(rnd->RndKine(), u);
+     } else {
+       u[0] = rnd->RndKine().Rndm();
+     }
+     gQ2 = Q2min + (Q2max-Q2min) * u[0];
      interaction->KinePtr()->SetQ2(gQ2);
      LOG("QELKinematics", pINFO) << "Trying: Q^2 = " << gQ2;
 
@@ -149,6 +160,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
         this->AssertXSecLimits(interaction, xsec, xsec_max);
+        if(envelope && xsec > xsec_max) envelope->Raise(u, fSafetyFactor*xsec);
 
         double t = xsec_max * rnd->RndKine().Rndm();
      //double J = kinematics::Jacobian(interaction,kPSQ2fE,kPSQD2fE);
@@ -460,6 +472,10 @@ void QELKinematicsGenerator::LoadConfig(void)
   //   an event weight?
   GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Sample Q2 from an adaptive envelope of the differential xsec rather
+  //   than a flat one?
+  GetParamDef( "AdaptiveEnvelope", fUseEnvelope, false ) ;
+  GetParamDef( "AdaptiveEnvelope-NBins", fEnvelopeNBins, 100 ) ;
 }
 //____________________________________________________________________________
 double QELKinematicsGenerator::ComputeMaxXSec(
@@ -532,3 +548,20 @@ double QELKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+double QELKinematicsGenerator::EnvelopeXSec(
+                     Interaction * interaction, const double * u) const
+{
+// Sets Q2 at the point u of the unit interval mapped onto the Q2 limits
+// and returns the differential xsec (see KineGeneratorWithCache)
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t Q2 = kps.Limits(kKVQ2);
+
+  double Q2min = Q2.min + kASmallNum;
+  double Q2max = Q2.max - kASmallNum;
+
+  interaction->KinePtr()->SetQ2(Q2min + (Q2max - Q2min) * u[0]);
+
+  return fXSecModel->XSec(interaction, kPSQ2fE);
+}
+//___________________________________________________________________________
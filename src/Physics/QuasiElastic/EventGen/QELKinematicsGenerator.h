@@ -46,6 +46,8 @@ private:
 
   void   LoadConfig     (void);
   double ComputeMaxXSec (const Interaction * in) const;
+  int    EnvelopeNDim   (void) const { return 1; }
+  double EnvelopeXSec   (Interaction * in, const double * u) const;
 };
 
 }      // genie namespace
@@ -9,6 +9,7 @@
 
 #pragma link C++ class genie::geometry::ROOTGeomAnalyzer;
 #pragma link C++ class genie::geometry::PointGeomAnalyzer;
+#pragma link C++ class genie::geometry::VoxelGeomAnalyzer;
 
 #pragma link C++ namespace genie::utils::geometry;
 
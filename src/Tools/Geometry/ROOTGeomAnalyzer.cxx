@@ -103,6 +103,12 @@ ROOTGeomAnalyzer::~ROOTGeomAnalyzer()
       << "ROOTGeomAnalyzer "
       << " mxddist " << fmxddist
       << " mxdstep " << fmxdstep;
+
+  if ( fNSwims > 0 )
+    LOG("GROOTGeom",pNOTICE)
+      << "ROOTGeomAnalyzer "
+      << " swims " << fNSwims
+      << " swim cache hits " << fNSwimCacheHits;
 }
 
 //===========================================================================
@@ -182,6 +188,44 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
   // reset current list of path-lengths
   fCurrPathLengthList->SetAllToZero();
 
+  if ( fUseWeightMatrix ) {
+    // swim once & sum the path-lengths for all materials in a single pass
+    // over the materials crossed by the ray
+    this->SwimOnce(pos,udir);
+
+    int ntgt = fCurrPDGCodeList->size();
+    fPathLengthSum.assign(ntgt,0.);
+
+    PathSegmentList::MaterialMapCItr_t mitr     =
+      fCurrPathSegmentList->GetMatStepSumMap().begin();
+    PathSegmentList::MaterialMapCItr_t mitr_end =
+      fCurrPathSegmentList->GetMatStepSumMap().end();
+    for ( ; mitr != mitr_end; ++mitr ) {
+      const TGeoMaterial * mat = mitr->first;
+      if ( ! mat ) continue;  // segment outside geometry has no material
+      double step = mitr->second;
+      const vector<double> & weights = this->MaterialWeights(mat);
+      for (int itgt = 0; itgt < ntgt; itgt++) {
+        fPathLengthSum[itgt] += step * weights[itgt];
+      }
+    }
+
+    for (int itgt = 0; itgt < ntgt; itgt++) {
+      int    pdgc = (*fCurrPDGCodeList)[itgt];
+      double pl   = fPathLengthSum[itgt];
+      fCurrPathLengthList->AddPathLength(pdgc,pl);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+      LOG("GROOTGeom", pINFO)
+        <<"Calculated path length for material: " << pdgc << " = " << pl;
+#endif
+    }
+
+    this->Local2SI(*fCurrPathLengthList); // curr geom units -> SI
+
+    return *fCurrPathLengthList;
+  }
+
   //loop over materials & compute the path-length
   vector<int>::iterator itr;
   for (itr=fCurrPDGCodeList->begin();itr!=fCurrPDGCodeList->end();itr++) {
@@ -244,7 +288,44 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
     this->Master2TopDir(udir);   // transform direction (master -> top)
   }
 
-  double maxwgt_dist = this->ComputePathLengthPDG(pos,udir,tgtpdg);
+  // walk the path segments of the last swim (normally the one done by
+  // ComputePathLengths for the same ray, so no navigation is needed here)
+  // and get the weighted step in each one
+  this->SwimOnce(pos,udir);
+
+  int itgt = this->TargetIndex(tgtpdg);
+  const genie::geometry::PathSegmentList::PathSegmentV_t& segments =
+    fCurrPathSegmentList->GetPathSegmentV();
+  int nseg = segments.size();
+  fSegWgtStep.resize(nseg);
+
+  double maxwgt_dist = 0;
+  const TGeoMaterial* wgt_mat = 0;
+  double wgt = 0;
+  for (int iseg = 0; iseg < nseg; iseg++) {
+    const TGeoMaterial* mat = segments[iseg].fMaterial;
+    // steps outside the geometry may have no assigned material
+    if ( iseg == 0 || mat != wgt_mat ) {
+      wgt = 0;
+      if ( mat ) {
+        if ( fUseWeightMatrix ) {
+          wgt = ( itgt >= 0 ) ? this->MaterialWeights(mat)[itgt] : 0;
+        } else {
+          wgt = this->GetWeight(mat,tgtpdg);
+        }
+      }
+      wgt_mat = mat;
+#ifdef RWH_DEBUG
+      if ( ( fDebugFlags & 0x02 ) && mat ) {
+        LOG("GROOTGeom", pINFO)
+          << " wgt[" << mat->GetName() << "] pdg " << tgtpdg << " wgt " << Form("%.6f",wgt);
+      }
+#endif
+    }
+    fSegWgtStep[iseg] = segments[iseg].GetSummedStepRange() * wgt;
+    maxwgt_dist += fSegWgtStep[iseg];
+  }
+
   if ( maxwgt_dist <= 0 ) {
     LOG("GROOTGeom", pERROR)
      << "The current trajectory does not cross the selected material!!";
@@ -273,38 +354,14 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
   }
 #endif
 
-  // compute the pdg weight for each material just once, then use a stl map
-  PathSegmentList::MaterialMap_t wgtmap;
-  PathSegmentList::MaterialMapCItr_t mitr     =
-    fCurrPathSegmentList->GetMatStepSumMap().begin();
-  PathSegmentList::MaterialMapCItr_t mitr_end =
-    fCurrPathSegmentList->GetMatStepSumMap().end();
-  // loop over map to get tgt weight for each material (once)
-  // steps outside the geometry may have no assigned material
-  for ( ; mitr != mitr_end; ++mitr ) {
-    const TGeoMaterial* mat = mitr->first;
-    double wgt = ( mat ) ? this->GetWeight(mat,tgtpdg) : 0;
-    wgtmap[mat] = wgt;
-#ifdef RWH_DEBUG
-    if ( ( fDebugFlags & 0x02 ) ) {
-      LOG("GROOTGeom", pINFO)
-        << " wgtmap[" << mat->GetName() << "] pdg " << tgtpdg << " wgt " << Form("%.6f",wgt);
-    }
-#endif
-  }
-
   // walk down the path to pick the vertex
-  const genie::geometry::PathSegmentList::PathSegmentV_t& segments =
-    fCurrPathSegmentList->GetPathSegmentV();
-  genie::geometry::PathSegmentList::PathSegVCItr_t sitr;
   double walked = 0;
-  for ( sitr = segments.begin(); sitr != segments.end(); ++sitr) {
-    const genie::geometry::PathSegment& seg = *sitr;
-    const TGeoMaterial* mat = seg.fMaterial;
-    double trimmed_step = seg.GetSummedStepRange();
-    double wgtstep = trimmed_step * wgtmap[mat];
+  for (int iseg = 0; iseg < nseg; iseg++) {
+    const genie::geometry::PathSegment& seg = segments[iseg];
+    double wgtstep = fSegWgtStep[iseg];
     double beyond = walked + wgtstep;
 #ifdef RWH_DEBUG
+    double trimmed_step = seg.GetSummedStepRange();
     if ( ( fDebugFlags & 0x04 ) ) {
       LOG("GROOTGeom", pINFO)
         << " beyond " << beyond << " genwgt_dist " << genwgt_dist
@@ -319,10 +376,10 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
           << "Choose vertex pos walked=" << walked
           << " beyond=" << beyond
           << " wgtstep " << wgtstep
-          << " ( " << trimmed_step << "*" << wgtmap[mat] << ")"
+          << " ( " << trimmed_step << "*" << wgtstep/trimmed_step << ")"
           << " look for " << genwgt_dist
           << " in " << seg.fVolume->GetName() << " "
-          << mat->GetName();
+          << seg.fMaterial->GetName();
       }
 #endif
       // choose a vertex in this segment (possibly multiple steps)
@@ -428,6 +485,15 @@ void ROOTGeomAnalyzer::SetMaxPlSafetyFactor(double sf)
     << "Max path length safety factor: " << fMaxPlSafetyFactor;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetWeightWithDensity(bool wt)
+{
+/// Weight the path lengths with the material density (or not)
+
+  fDensWeight = wt;
+  fMatWeights.clear(); // material weights are recomputed on demand
+}
+
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::SetMixtureWeightsSum(double sum)
 {
@@ -436,6 +502,7 @@ void ROOTGeomAnalyzer::SetMixtureWeightsSum(double sum)
 /// compute the correct weight normalization.
 
   fMixtWghtSum = sum;
+  fMatWeights.clear(); // material weights are recomputed on demand
 }
 
 //___________________________________________________________________________
@@ -659,6 +726,7 @@ void ROOTGeomAnalyzer::Initialize(void)
   fTopVolume             = 0;
   fTopVolumeName         = "";
   fKeepSegPath           = false;
+  fUseWeightMatrix       = true;
 
   // some defaults:
   this -> SetScannerNPoints    (200);
@@ -676,6 +744,8 @@ void ROOTGeomAnalyzer::Initialize(void)
   fmxddist = 0;
   fmxdstep = 0;
   fDebugFlags = 0;
+  fNSwims = 0;
+  fNSwimCacheHits = 0;
 }
 
 //___________________________________________________________________________
@@ -814,6 +884,17 @@ void ROOTGeomAnalyzer::BuildListOfTargetNuclei(void)
   // list is easier to read so this doesn't cost much
   std::sort(fCurrPDGCodeList->begin(),fCurrPDGCodeList->end());
 
+  // precompute the (material x target) weight matrix
+  fMatWeights.clear();
+  std::vector<TGeoVolume*>::const_iterator vitr = volvec.begin();
+  for ( ; vitr != volvec.end(); ++vitr) {
+    this->MaterialWeights((*vitr)->GetMedium()->GetMaterial());
+  }
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("GROOTGeom", pDEBUG)
+    << "Weight matrix: " << fMatWeights.size() << " materials x "
+    << fCurrPDGCodeList->size() << " targets";
+#endif
 }
 
 //___________________________________________________________________________
@@ -970,6 +1051,37 @@ double ROOTGeomAnalyzer::GetWeight(const TGeoMixture* mixt, int ielement, int pd
   return weight;
 }
 
+//___________________________________________________________________________
+const vector<double> & ROOTGeomAnalyzer::MaterialWeights(
+                                                const TGeoMaterial * mat)
+{
+/// Get the weights of all target nuclei (in the order of the target list)
+/// in the input material. They are computed once per material and cached.
+/// Weights are in the curr geom density units.
+
+  MaterialWeightMap_t::const_iterator mitr = fMatWeights.find(mat);
+  if ( mitr != fMatWeights.end() ) return mitr->second;
+
+  vector<double> & weights = fMatWeights[mat];
+  int ntgt = fCurrPDGCodeList->size();
+  weights.resize(ntgt,0.);
+  for (int itgt = 0; itgt < ntgt; itgt++) {
+    weights[itgt] = this->GetWeight(mat,(*fCurrPDGCodeList)[itgt]);
+  }
+  return weights;
+}
+
+//___________________________________________________________________________
+int ROOTGeomAnalyzer::TargetIndex(int pdgc) const
+{
+/// Position of the input target in the (sorted) target list, or -1
+
+  vector<int>::const_iterator itr =
+    std::lower_bound(fCurrPDGCodeList->begin(),fCurrPDGCodeList->end(),pdgc);
+  if ( itr == fCurrPDGCodeList->end() || *itr != pdgc ) return -1;
+  return itr - fCurrPDGCodeList->begin();
+}
+
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
 {
@@ -1310,11 +1422,18 @@ double ROOTGeomAnalyzer::ComputePathLengthPDG(
     fCurrPathSegmentList->GetMatStepSumMap().begin();
   PathSegmentList::MaterialMapCItr_t itr_end =
     fCurrPathSegmentList->GetMatStepSumMap().end();
+  int itgt = ( fUseWeightMatrix ) ? this->TargetIndex(pdgc) : -1;
+  if ( fUseWeightMatrix && itgt < 0 ) {
+    LOG("GROOTGeom", pERROR) << "Target doesn't exist. Return path length = 0.";
+    return 0;
+  }
+
   for ( ; itr != itr_end; ++itr ) {
     mat  = itr->first;
     if ( ! mat ) continue;  // segment outside geometry has no material
     step = itr->second;
-    weight = this->GetWeight(mat,pdgc);
+    weight = ( fUseWeightMatrix ) ? this->MaterialWeights(mat)[itgt] :
+                                    this->GetWeight(mat,pdgc);
     pl += (step*weight);
   }
 
@@ -1338,7 +1457,11 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
   if ( ! fCurrPathSegmentList ) fCurrPathSegmentList = new PathSegmentList();
 
   // don't swim if the current PathSegmentList is up-to-date
-  if ( fCurrPathSegmentList->IsSameStart(r0,udir) ) return;
+  if ( fCurrPathSegmentList->IsSameStart(r0,udir) ) {
+    fNSwimCacheHits++;
+    return;
+  }
+  fNSwims++;
 
   // start fresh
   fCurrPathSegmentList->SetAllToZero();
@@ -1440,6 +1563,8 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
             }
 #endif
             fCurrPathSegmentList->SetAllToZero();
+            // remember that this ray misses the geometry
+            fCurrPathSegmentList->SetStartInfo(r0,udir);
             return;
           }
         } // finished while
@@ -27,6 +27,8 @@
 
 #include <string>
 #include <algorithm>
+#include <map>
+#include <vector>
 
 #include <TGeoManager.h>
 #include <TVector3.h>
@@ -41,6 +43,8 @@ class TGeoElement;
 class TGeoHMatrix;
 
 using std::string;
+using std::map;
+using std::vector;
 
 namespace genie    {
 
@@ -75,7 +79,7 @@ public :
   virtual void SetScannerNRays      (int    nr) { fNRays      = nr; } /* box  scanner */
   virtual void SetScannerNParticles (int    np) { fNParticles = np; } /* flux scanner */
   virtual void SetScannerFlux       (GFluxI* f) { fFlux       = f;  } /* flux scanner */
-  virtual void SetWeightWithDensity (bool   wt) { fDensWeight = wt; }
+  virtual void SetWeightWithDensity (bool   wt);
   virtual void SetMixtureWeightsSum (double sum);
   virtual void SetLengthUnits       (double lu);
   virtual void SetDensityUnits      (double du);
@@ -83,6 +87,7 @@ public :
   virtual void SetTopVolName        (string nm);
   virtual void SetKeepSegPath       (bool keep) { fKeepSegPath = keep; }
   virtual void SetDebugFlags        (int  flgs) { fDebugFlags  = flgs; }
+  virtual void SetUseWeightMatrix   (bool   um) { fUseWeightMatrix = um; }
 
   /// retrieve geometry driver's configuration options
 
@@ -97,8 +102,14 @@ public :
   virtual string        TopVolName        (void) const { return fTopVolumeName;     }
   virtual TGeoManager * GetGeometry       (void) const { return fGeometry;          }
   virtual bool          GetKeepSegPath    (void) const { return fKeepSegPath;       }
+  virtual bool          UseWeightMatrix   (void) const { return fUseWeightMatrix;   }
   virtual const PathLengthList& GetMaxPathLengths(void) const { return *fCurrMaxPathLengthList; } // call only after ComputeMaxPathLengths() has been called
 
+  /// swim statistics: rays swum through the geometry & requests served by the last swim
+
+  virtual long int      NSwims            (void) const { return fNSwims;            }
+  virtual long int      NSwimCacheHits    (void) const { return fNSwimCacheHits;    }
+
   /// access to geometry coordinate/unit transforms for validation/test purposes
 
   virtual void   Local2SI      (PathLengthList & pl) const;
@@ -129,6 +140,9 @@ protected:
   virtual double GetWeight               (const TGeoMixture * mixt, int pdgc);
   virtual double GetWeight               (const TGeoMixture * mixt, int ielement, int pdgc);
 
+  virtual const vector<double> & MaterialWeights (const TGeoMaterial * mat);
+  virtual int                    TargetIndex     (int pdgc) const;
+
   virtual void   MaxPathLengthsFluxMethod(void);
   virtual void   MaxPathLengthsBoxMethod (void);
   virtual bool   GenBoxRay               (int indx, TLorentzVector& x4, TLorentzVector& p4);
@@ -168,6 +182,14 @@ protected:
   PathSegmentList* fCurrPathSegmentList;   ///< current list of path-segments
   GeomVolSelectorI* fGeomVolSelector;      ///< optional path seg trimmer (owned)
 
+  // (material x target) weight matrix, so that each ray is swum once and
+  // the path lengths for all targets are summed in a single pass
+  typedef map<const TGeoMaterial *, vector<double> > MaterialWeightMap_t;
+  bool                fUseWeightMatrix;    ///< use the weight matrix rather than GetWeight() per target [def:true]
+  MaterialWeightMap_t fMatWeights;         ///< weight of each target (fCurrPDGCodeList order) in each material
+  vector<double>      fPathLengthSum;      ///< path length sums for all targets (fCurrPDGCodeList order)
+  vector<double>      fSegWgtStep;         ///< weighted step in each segment of the current path (GenerateVertex)
+
   // used by GenBoxRay to retain history between calls
   TVector3         fGenBoxRayPos;
   TVector3         fGenBoxRayDir;
@@ -178,6 +200,8 @@ protected:
   // test purposes
   double           fmxddist, fmxdstep;   ///< max errors in pathsegmentlist
   int              fDebugFlags;
+  long int         fNSwims;              ///< number of rays swum through the geometry
+  long int         fNSwimCacheHits;      ///< number of SwimOnce calls reusing the last swim
 
 };
 
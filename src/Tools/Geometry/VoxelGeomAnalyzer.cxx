@@ -0,0 +1,424 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <cfloat>
+#include <map>
+
+#include <TGeoManager.h>
+#include <TGeoVolume.h>
+#include <TGeoMedium.h>
+#include <TGeoMaterial.h>
+#include <TGeoNode.h>
+#include <TGeoBBox.h>
+#include <TLorentzVector.h>
+#include <TMath.h>
+
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Tools/Geometry/VoxelGeomAnalyzer.h"
+
+using namespace genie;
+using namespace genie::geometry;
+
+//___________________________________________________________________________
+VoxelGeomAnalyzer::VoxelGeomAnalyzer(string geometry_filename) :
+ROOTGeomAnalyzer(geometry_filename)
+{
+  this->InitVoxels();
+}
+
+//___________________________________________________________________________
+VoxelGeomAnalyzer::VoxelGeomAnalyzer(TGeoManager * gm) :
+ROOTGeomAnalyzer(gm)
+{
+  this->InitVoxels();
+}
+
+//___________________________________________________________________________
+VoxelGeomAnalyzer::~VoxelGeomAnalyzer()
+{
+
+}
+
+//___________________________________________________________________________
+const PathLengthList & VoxelGeomAnalyzer::ComputePathLengths(
+                          const TLorentzVector & x, const TLorentzVector & p)
+{
+/// Computes the path-length within each detector material for a
+/// neutrino starting from point x (master coord) and travelling along
+/// the direction of p (master coord), by marching through the voxel grid.
+/// The computed path lengths are in SI units (kgr/m^2, if density
+/// weighting is enabled)
+
+  // trimming needs the actual path segments
+  if ( fGeomVolSelector ) return ROOTGeomAnalyzer::ComputePathLengths(x,p);
+
+  if ( ! fVoxelGridBuilt ) this->BuildVoxelGrid();
+
+  TVector3 udir = p.Vect().Unit(); // unit vector along direction
+  TVector3 pos = x.Vect();         // initial position
+  this->SI2Local(pos);             // SI -> curr geom units
+
+  if (!fMasterToTopIsIdentity) {
+    this->Master2Top(pos);         // transform position (master -> top)
+    this->Master2TopDir(udir);     // transform direction (master -> top)
+  }
+
+  // reset current list of path-lengths
+  fCurrPathLengthList->SetAllToZero();
+
+  this->MarchRay(pos,udir);
+
+  // sum the step in each composition
+  int nseg = fRayComp.size();
+  for (int iseg = 0; iseg < nseg; iseg++) {
+    int icomp = fRayComp[iseg];
+    if ( icomp == 0 ) continue;
+    if ( fCompStep[icomp] == 0 ) fCompHit.push_back(icomp);
+    fCompStep[icomp] += fRayStep[iseg];
+  }
+
+  // sum the path-lengths for all targets
+  int ntgt = fCurrPDGCodeList->size();
+  fPathLengthSum.assign(ntgt,0.);
+
+  vector<int>::const_iterator citr = fCompHit.begin();
+  for ( ; citr != fCompHit.end(); ++citr) {
+    int icomp = *citr;
+    const double * weights = &fCompWeights[icomp*ntgt];
+    for (int itgt = 0; itgt < ntgt; itgt++) {
+      fPathLengthSum[itgt] += fCompStep[icomp] * weights[itgt];
+    }
+    fCompStep[icomp] = 0;
+  }
+  fCompHit.clear();
+
+  for (int itgt = 0; itgt < ntgt; itgt++) {
+    fCurrPathLengthList->AddPathLength(
+       (*fCurrPDGCodeList)[itgt], fPathLengthSum[itgt]);
+  }
+
+  this->Local2SI(*fCurrPathLengthList); // curr geom units -> SI
+
+  return *fCurrPathLengthList;
+}
+
+//___________________________________________________________________________
+const TVector3 & VoxelGeomAnalyzer::GenerateVertex(
+              const TLorentzVector & x, const TLorentzVector & p, int tgtpdg)
+{
+/// Generates a random vertex, within the detector material with the input
+/// PDG code, using the exact ROOTGeomAnalyzer algorithm. If, owing to the
+/// voxel approximation, the selected material is not actually crossed by
+/// the ray, the vertex is generated along the voxelised path instead.
+
+  if ( fGeomVolSelector ) return ROOTGeomAnalyzer::GenerateVertex(x,p,tgtpdg);
+
+  TVector3 udir = p.Vect().Unit();
+  TVector3 pos = x.Vect();
+  this->SI2Local(pos);           // SI -> curr geom units
+
+  if (!fMasterToTopIsIdentity) {
+    this->Master2Top(pos);       // transform position (master -> top)
+    this->Master2TopDir(udir);   // transform direction (master -> top)
+  }
+
+  // exact path length (the swim is reused by ROOTGeomAnalyzer::GenerateVertex)
+  if ( this->ComputePathLengthPDG(pos,udir,tgtpdg) > 0 ) {
+    return ROOTGeomAnalyzer::GenerateVertex(x,p,tgtpdg);
+  }
+
+  LOG("GROOTGeom", pWARN)
+    << "Material: " << tgtpdg << " is only crossed in the voxelised geometry"
+    << " - Generating the vertex along the voxelised path";
+
+  fCurrVertex->SetXYZ(0.,0.,0.);
+
+  if ( ! fVoxelGridBuilt ) this->BuildVoxelGrid();
+  this->MarchRay(pos,udir);
+
+  int itgt = this->TargetIndex(tgtpdg);
+  int ntgt = fCurrPDGCodeList->size();
+  int nseg = fRayComp.size();
+  double maxwgt_dist = 0;
+  for (int iseg = 0; iseg < nseg && itgt >= 0; iseg++) {
+    maxwgt_dist += fRayStep[iseg] * fCompWeights[fRayComp[iseg]*ntgt + itgt];
+  }
+  if ( maxwgt_dist <= 0 ) {
+    LOG("GROOTGeom", pERROR)
+     << "The current trajectory does not cross the selected material!!";
+    return *fCurrVertex;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double genwgt_dist = maxwgt_dist * rnd->RndGeom().Rndm();
+
+  double t      = fRayT0;
+  double walked = 0;
+  for (int iseg = 0; iseg < nseg; iseg++) {
+    double wgtstep = fRayStep[iseg] * fCompWeights[fRayComp[iseg]*ntgt + itgt];
+    if ( wgtstep > 0 && walked + wgtstep > genwgt_dist ) {
+      t += fRayStep[iseg] * (genwgt_dist - walked) / wgtstep;
+      break;
+    }
+    walked += wgtstep;
+    t      += fRayStep[iseg];
+  }
+
+  pos += t * udir;
+
+  if (!fMasterToTopIsIdentity) {
+     this->Top2Master(pos); // transform position (top -> master)
+  }
+  this->Local2SI(pos);   // curr geom units -> SI
+
+  fCurrVertex->SetXYZ(pos[0],pos[1],pos[2]);
+
+  return *fCurrVertex;
+}
+
+//___________________________________________________________________________
+void VoxelGeomAnalyzer::SetWeightWithDensity(bool wt)
+{
+  ROOTGeomAnalyzer::SetWeightWithDensity(wt);
+  this->ClearVoxelGrid();
+}
+
+//___________________________________________________________________________
+void VoxelGeomAnalyzer::SetMixtureWeightsSum(double sum)
+{
+  ROOTGeomAnalyzer::SetMixtureWeightsSum(sum);
+  this->ClearVoxelGrid();
+}
+
+//___________________________________________________________________________
+void VoxelGeomAnalyzer::SetTopVolName(string name)
+{
+  ROOTGeomAnalyzer::SetTopVolName(name);
+  this->ClearVoxelGrid();
+}
+
+//___________________________________________________________________________
+void VoxelGeomAnalyzer::SetVoxelSize(double size)
+{
+  fVoxelSize = size;
+  LOG("GROOTGeom", pNOTICE) << "Voxel size (GU): " << fVoxelSize;
+
+  this->ClearVoxelGrid();
+}
+
+//___________________________________________________________________________
+void VoxelGeomAnalyzer::SetVoxelSamples(int ns)
+{
+  fVoxelSamples = TMath::Max(ns,1);
+  LOG("GROOTGeom", pNOTICE)
+    << "Sampling points per voxel side: " << fVoxelSamples;
+
+  this->ClearVoxelGrid();
+}
+
+//___________________________________________________________________________
+void VoxelGeomAnalyzer::BuildVoxelGrid(void)
+{
+/// Divide the top volume bounding box into voxels and average the weight
+/// of each target nucleus over fVoxelSamples^3 points in each voxel.
+/// Voxels with the same averaged weights share a composition entry.
+
+  this->ClearVoxelGrid();
+
+  TGeoBBox * box = (TGeoBBox *) fTopVolume->GetShape();
+  double half[3] = { box->GetDX(), box->GetDY(), box->GetDZ() };
+  const Double_t * origin = box->GetOrigin();
+
+  double size = fVoxelSize;
+  if ( size <= 0 ) {
+    size = 2 * TMath::Max(half[0], TMath::Max(half[1],half[2])) / 100.;
+  }
+  long int nvox = 1;
+  for (int k = 0; k < 3; k++) {
+    fNVox   [k] = TMath::Max(1, TMath::CeilNint(2*half[k]/size));
+    fVoxStep[k] = 2*half[k] / fNVox[k];
+    fVoxLo  [k] = origin[k] - half[k];
+    nvox *= fNVox[k];
+  }
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Building a " << fNVox[0] << " x " << fNVox[1] << " x " << fNVox[2]
+    << " voxel grid (voxel size (GU): " << fVoxStep[0] << " x "
+    << fVoxStep[1] << " x " << fVoxStep[2] << ", "
+    << fVoxelSamples << "^3 sampling points / voxel)";
+
+  int ntgt = fCurrPDGCodeList->size();
+  int ns   = fVoxelSamples;
+  double wsample = 1. / (ns*ns*ns);
+
+  // composition 0: no target nuclei
+  std::map<vector<double>, int> comp_index;
+  vector<double> avg(ntgt,0.);
+  comp_index[avg] = 0;
+  fCompWeights = avg;
+
+  fVoxComp.resize(nvox,0);
+
+  long int ivox = 0;
+  for (int ix = 0; ix < fNVox[0]; ix++) {
+    for (int iy = 0; iy < fNVox[1]; iy++) {
+      for (int iz = 0; iz < fNVox[2]; iz++, ivox++) {
+
+        avg.assign(ntgt,0.);
+        for (int sx = 0; sx < ns; sx++) {
+          double x = fVoxLo[0] + (ix + (sx+0.5)/ns) * fVoxStep[0];
+          for (int sy = 0; sy < ns; sy++) {
+            double y = fVoxLo[1] + (iy + (sy+0.5)/ns) * fVoxStep[1];
+            for (int sz = 0; sz < ns; sz++) {
+              double z = fVoxLo[2] + (iz + (sz+0.5)/ns) * fVoxStep[2];
+
+              TGeoNode * node = fGeometry->FindNode(x,y,z);
+              if ( !node || fGeometry->IsOutside() ) continue;
+              const TGeoMaterial * mat =
+                         node->GetVolume()->GetMedium()->GetMaterial();
+              const vector<double> & weights = this->MaterialWeights(mat);
+              for (int itgt = 0; itgt < ntgt; itgt++) {
+                avg[itgt] += wsample * weights[itgt];
+              }
+            }
+          }
+        }
+
+        std::map<vector<double>, int>::const_iterator citr =
+                                                  comp_index.find(avg);
+        if ( citr != comp_index.end() ) {
+          fVoxComp[ivox] = citr->second;
+        } else {
+          int icomp = comp_index.size();
+          comp_index[avg] = icomp;
+          fCompWeights.insert(fCompWeights.end(), avg.begin(), avg.end());
+          fVoxComp[ivox] = icomp;
+        }
+      }
+    }
+  }
+
+  fCompStep.assign(comp_index.size(),0.);
+  fCompHit.clear();
+  fVoxelGridBuilt = true;
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Voxel grid built: " << nvox << " voxels, "
+    << comp_index.size() << " distinct compositions of "
+    << ntgt << " targets";
+}
+
+//___________________________________________________________________________
+void VoxelGeomAnalyzer::MarchRay(const TVector3 & pos, const TVector3 & udir)
+{
+/// March through the voxel grid (3D-DDA) from the input position (top vol
+/// coord & units) along the direction of the unit vector udir (top vol
+/// coord). Fills the steps in consecutive voxels of the same composition.
+
+  fRayComp.clear();
+  fRayStep.clear();
+  fRayT0 = 0;
+
+  double r[3] = { pos.X(),  pos.Y(),  pos.Z()  };
+  double u[3] = { udir.X(), udir.Y(), udir.Z() };
+
+  // clip the ray to the voxel grid
+  double tmin = 0;
+  double tmax = DBL_MAX;
+  for (int k = 0; k < 3; k++) {
+    double lo = fVoxLo[k];
+    double hi = fVoxLo[k] + fNVox[k]*fVoxStep[k];
+    if ( u[k] == 0 ) {
+      if ( r[k] < lo || r[k] > hi ) return;
+      continue;
+    }
+    double t1 = (lo - r[k]) / u[k];
+    double t2 = (hi - r[k]) / u[k];
+    tmin = TMath::Max(tmin, TMath::Min(t1,t2));
+    tmax = TMath::Min(tmax, TMath::Max(t1,t2));
+  }
+  if ( tmin >= tmax ) return;
+
+  fRayT0 = tmin;
+
+  int    ivox  [3];
+  int    istep [3];
+  double tnext [3];
+  double tdelta[3];
+  for (int k = 0; k < 3; k++) {
+    double rk = r[k] + tmin * u[k];
+    int i = TMath::FloorNint((rk - fVoxLo[k]) / fVoxStep[k]);
+    ivox[k] = TMath::Min(TMath::Max(i,0), fNVox[k]-1);
+    if ( u[k] > 0 ) {
+      istep [k] = 1;
+      tnext [k] = tmin + (fVoxLo[k] + (ivox[k]+1)*fVoxStep[k] - rk) / u[k];
+      tdelta[k] = fVoxStep[k] / u[k];
+    } else if ( u[k] < 0 ) {
+      istep [k] = -1;
+      tnext [k] = tmin + (fVoxLo[k] + ivox[k]*fVoxStep[k] - rk) / u[k];
+      tdelta[k] = -fVoxStep[k] / u[k];
+    } else {
+      istep [k] = 0;
+      tnext [k] = DBL_MAX;
+      tdelta[k] = DBL_MAX;
+    }
+  }
+
+  double t = tmin;
+  while ( t < tmax ) {
+    int k = (tnext[0] < tnext[1]) ?
+               ((tnext[0] < tnext[2]) ? 0 : 2) :
+               ((tnext[1] < tnext[2]) ? 1 : 2);
+    double tend = TMath::Max(t, TMath::Min(tnext[k], tmax));
+
+    int icomp = fVoxComp[(ivox[0]*fNVox[1] + ivox[1])*fNVox[2] + ivox[2]];
+    if ( !fRayComp.empty() && fRayComp.back() == icomp ) {
+      fRayStep.back() += (tend - t);
+    } else {
+      fRayComp.push_back(icomp);
+      fRayStep.push_back(tend - t);
+    }
+
+    t = tend;
+    ivox[k] += istep[k];
+    if ( ivox[k] < 0 || ivox[k] >= fNVox[k] ) break;
+    tnext[k] += tdelta[k];
+  }
+}
+
+//___________________________________________________________________________
+void VoxelGeomAnalyzer::InitVoxels(void)
+{
+  fVoxelSize      = -1;
+  fVoxelSamples   = 2;
+  fVoxelGridBuilt = false;
+  fRayT0          = 0;
+
+  for (int k = 0; k < 3; k++) {
+    fNVox   [k] = 0;
+    fVoxLo  [k] = 0;
+    fVoxStep[k] = 0;
+  }
+}
+
+//___________________________________________________________________________
+void VoxelGeomAnalyzer::ClearVoxelGrid(void)
+{
+  fVoxelGridBuilt = false;
+
+  fVoxComp.clear();
+  fCompWeights.clear();
+  fCompStep.clear();
+  fCompHit.clear();
+  fRayComp.clear();
+  fRayStep.clear();
+}
+
+//___________________________________________________________________________
@@ -0,0 +1,105 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::geometry::VoxelGeomAnalyzer
+
+\brief    A ROOT geometry driver computing path lengths on a voxel grid.
+
+          The bounding box of the top volume is divided into voxels and the
+          weight (density, if density weighting is on) of each target nucleus
+          is averaged over a number of sampling points in each voxel, once.
+          Path lengths are then computed by marching each ray through the
+          voxel grid (3D-DDA), without any TGeo navigation. Vertices are still
+          generated by the exact ROOTGeomAnalyzer algorithm, so each accepted
+          event costs a single TGeo swim (if the selected material is only
+          crossed in the voxelised geometry, the vertex is generated along
+          the voxelised path instead).
+
+          The approximation only affects the path lengths: within a voxel that
+          contains a material boundary the weights are smeared over the voxel.
+          For each boundary crossed, the error on the path length of a target
+          is at most ~ sqrt(3) x voxel size x the change in its weight across
+          the boundary (smaller on average, as the error changes sign from
+          one side of a thin volume to the other). Volumes thinner than a
+          voxel are diluted within their voxels but keep their mass, up to
+          the sampling error of the voxel averages. Use SetVoxelSize() and
+          SetVoxelSamples() to trade accuracy for memory and build time.
+
+          Path segment trimming (GeomVolSelectorI) needs the exact volume
+          information, so rays are swum through the geometry when a selector
+          is set.
+
+\author   GENIE Collaboration
+
+\created  October 15, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _VOXEL_GEOMETRY_ANALYZER_H_
+#define _VOXEL_GEOMETRY_ANALYZER_H_
+
+#include "Tools/Geometry/ROOTGeomAnalyzer.h"
+
+namespace genie    {
+namespace geometry {
+
+class VoxelGeomAnalyzer : public ROOTGeomAnalyzer {
+
+public :
+  VoxelGeomAnalyzer(string geometry_filename);
+  VoxelGeomAnalyzer(TGeoManager * gm);
+ ~VoxelGeomAnalyzer();
+
+  /// override the ROOTGeomAnalyzer path length calculation
+
+  virtual const  PathLengthList & ComputePathLengths(const TLorentzVector & x,
+                                                     const TLorentzVector & p);
+  virtual const  TVector3 &       GenerateVertex(const TLorentzVector & x,
+                                                 const TLorentzVector & p, int tgtpdg);
+
+  /// settings invalidating the voxel grid
+
+  virtual void SetWeightWithDensity (bool   wt);
+  virtual void SetMixtureWeightsSum (double sum);
+  virtual void SetTopVolName        (string nm);
+
+  /// set / retrieve the voxel grid configuration
+
+  virtual void   SetVoxelSize    (double size); ///< in geometry units [def: 1/100 of the longest bounding box side]
+  virtual void   SetVoxelSamples (int    ns);   ///< sampling points / voxel side [def:2]
+  virtual double VoxelSize       (void) const { return fVoxelSize;    }
+  virtual int    VoxelSamples    (void) const { return fVoxelSamples; }
+
+  /// build the voxel grid (otherwise built with the first ray)
+
+  virtual void   BuildVoxelGrid  (void);
+
+protected:
+
+  virtual void   InitVoxels      (void);
+  virtual void   ClearVoxelGrid  (void);
+  virtual void   MarchRay        (const TVector3 & r, const TVector3 & udir);
+
+  double           fVoxelSize;      ///< input voxel size (<=0: use the default)
+  int              fVoxelSamples;   ///< sampling points per voxel side
+  bool             fVoxelGridBuilt; ///< is the voxel grid up-to-date?
+
+  int              fNVox[3];        ///< number of voxels along x,y,z
+  double           fVoxLo[3];       ///< lower corner of the voxel grid (top vol coords & units)
+  double           fVoxStep[3];     ///< voxel size along x,y,z (top vol units)
+  vector<int>      fVoxComp;        ///< composition index of each voxel (0: no targets)
+  vector<double>   fCompWeights;    ///< target weights (fCurrPDGCodeList order) of each composition
+  vector<double>   fCompStep;       ///< summed step in each composition along the current ray
+  vector<int>      fCompHit;        ///< compositions crossed by the current ray
+  double           fRayT0;          ///< distance to the voxel grid along the current ray
+  vector<int>      fRayComp;        ///< compositions along the current ray (consecutive voxels merged)
+  vector<double>   fRayStep;        ///< step in each of the above
+};
+
+}      // geometry namespace
+}      // genie    namespace
+
+#endif // _VOXEL_GEOMETRY_ANALYZER_H_
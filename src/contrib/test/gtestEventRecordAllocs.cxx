@@ -0,0 +1,153 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestEventRecordAllocs
+
+\brief   Counts the heap allocations (and the CPU time) per generated event
+         for the QEL, RES and DIS channels, with and without recycling of
+         the event records (see EventRecordPool).
+
+         Each event is released as soon as it is generated, as an output
+         writer would do after writing it.
+
+\syntax  gtestEventRecordAllocs [-n nev] [-e energy] [-p nu_pdg] [-t tgt_pdg]
+                                [--cross-sections xml_file] [--tune tune]
+                                [--message-thresholds xml_file]
+
+         Options:
+
+          -n  Number of events per channel & mode [default: 1000]
+          -e  Neutrino energy (GeV) [default: 3]
+          -p  Neutrino PDG code [default: 14]
+          -t  Target PDG code [default: 1000080160]
+          --cross-sections
+              Pre-computed cross-section splines (strongly recommended:
+              otherwise cross sections are calculated on the fly).
+
+\author  GENIE Collaboration
+
+\created October 15, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+#include <TStopwatch.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+
+using std::string;
+
+using namespace genie;
+
+//____________________________________________________________________________
+// count all allocations made through the global operator new
+
+#if __cplusplus >= 201103L
+#define GTEST_THROW_BAD_ALLOC
+#define GTEST_NOTHROW noexcept
+#else
+#define GTEST_THROW_BAD_ALLOC throw(std::bad_alloc)
+#define GTEST_NOTHROW throw()
+#endif
+
+static unsigned long gNAllocs = 0;
+
+void * operator new (size_t size) GTEST_THROW_BAD_ALLOC
+{
+  gNAllocs++;
+  void * p = malloc(size ? size : 1);
+  if(!p) throw std::bad_alloc();
+  return p;
+}
+void * operator new[] (size_t size) GTEST_THROW_BAD_ALLOC
+{
+  gNAllocs++;
+  void * p = malloc(size ? size : 1);
+  if(!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete   (void * p) GTEST_NOTHROW { free(p); }
+void operator delete[] (void * p) GTEST_NOTHROW { free(p); }
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  int    nev   = (parser.OptionExists('n')) ? parser.ArgAsInt('n')    : 1000;
+  double Ev    = (parser.OptionExists('e')) ? parser.ArgAsDouble('e') : 3.;
+  int    nupdg = (parser.OptionExists('p')) ? parser.ArgAsInt('p')    : 14;
+  int    tgt   = (parser.OptionExists('t')) ? parser.ArgAsInt('t')    : 1000080160;
+  string xsec  = (parser.OptionExists("cross-sections")) ?
+                  parser.ArgAsString("cross-sections") : "";
+
+  RunOpt::Instance()->BuildTune();
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(-1);
+  utils::app_init::XSecTable(xsec, false);
+
+  InitialState init_state(tgt, nupdg);
+  TLorentzVector nu_p4(0.,0.,Ev,Ev);
+
+  const int nchannels = 3;
+  const char * channel [nchannels] = { "QEL",  "RES",   "DIS"   };
+  const char * evgenlst[nchannels] = { "CCQE", "CCRES", "CCDIS" };
+
+  EventRecordPool * pool = EventRecordPool::Instance();
+
+  for(int ich = 0; ich < nchannels; ich++) {
+
+    GEVGDriver driver;
+    driver.SetEventGeneratorList(evgenlst[ich]);
+    driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+    driver.Configure(init_state);
+    driver.UseSplines();
+
+    for(int imode = 0; imode < 2; imode++) {
+      bool recycle = (imode == 1);
+      pool->SetEnabled(recycle);
+
+      // warm-up (fill the caches & the pool)
+      for(int i = 0; i < 10; i++) {
+        pool->Release(driver.GenerateEvent(nu_p4));
+      }
+
+      TStopwatch sw;
+      unsigned long nallocs = gNAllocs;
+      int ngen = 0;
+      for(int i = 0; i < nev; i++) {
+        EventRecord * event = driver.GenerateEvent(nu_p4);
+        if(event) ngen++;
+        pool->Release(event);
+      }
+      nallocs = gNAllocs - nallocs;
+      sw.Stop();
+
+      LOG("test", pNOTICE)
+        << channel[ich] << " (" << evgenlst[ich] << "), "
+        << ((recycle) ? "recycled" : "new     ") << " event records: "
+        << (double) nallocs / TMath::Max(ngen,1) << " allocations / event, "
+        << 1E+3 * sw.CpuTime() / TMath::Max(ngen,1) << " ms / event";
+    }
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
@@ -0,0 +1,154 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestFluxProbWorkers
+
+\brief   Checks that the flux interaction probabilities pre-calculated by
+         gevgen_t2k do not depend on the number of processes
+         (--flux-prob-workers option).
+
+         gevgen_t2k is run twice in flux interaction probability mode (-S),
+         with 1 and with n processes, and the two output trees are compared
+         entry by entry (flux index, neutrino code, energy, weight and
+         interaction probability). The program prints the first differing
+         entries, if any, and returns a non-zero status if the trees differ.
+
+\syntax  gtestFluxProbWorkers -a "gevgen_t2k arguments" [-w nworkers]
+                              [-o output_prefix]
+
+         Options:
+
+          -a  Arguments of gevgen_t2k (flux, geometry, detector location,
+              cross sections, ...), without the -S, -P and
+              --flux-prob-workers options
+          -w  Number of processes of the second run [default: 4]
+          -o  Prefix of the output files [default: gtestFluxProbWorkers]
+
+\author  GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <sstream>
+#include <string>
+
+#include <TFile.h>
+#include <TMath.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/SystemUtils.h"
+
+using std::ostringstream;
+using std::string;
+
+using namespace genie;
+
+bool RunFluxProbs (const string & options, int nworkers, const string & filename);
+long CompareTrees (const string & filename1, const string & filename2);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  if(!parser.OptionExists('a')) {
+    LOG("test", pFATAL) << "Specify the gevgen_t2k arguments with -a";
+    return 1;
+  }
+  string options  = parser.ArgAsString('a');
+  int    nworkers = (parser.OptionExists('w')) ? parser.ArgAsInt('w')    : 4;
+  string prefix   = (parser.OptionExists('o')) ? parser.ArgAsString('o') :
+                                                 "gtestFluxProbWorkers";
+
+  string file1 = prefix + ".1worker.root";
+  ostringstream filen;
+  filen << prefix << "." << nworkers << "workers.root";
+
+  if(!RunFluxProbs(options, 1,        file1     ) ||
+     !RunFluxProbs(options, nworkers, filen.str())) {
+    LOG("test", pFATAL) << "gevgen_t2k failed";
+    return 1;
+  }
+
+  long ndiff = CompareTrees(file1, filen.str());
+
+  LOG("test", pNOTICE)
+    << "Flux interaction probabilities with 1 and " << nworkers
+    << " processes: " << ((ndiff == 0) ? "identical" : "DIFFERENT")
+    << " (" << ndiff << " differing entries)";
+
+  return (ndiff == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+bool RunFluxProbs(const string & options, int nworkers, const string & filename)
+{
+  gSystem->Unlink(filename.c_str());
+
+  ostringstream cmd;
+  cmd << "gevgen_t2k " << options << " -S " << filename
+      << " --flux-prob-workers " << nworkers;
+
+  LOG("test", pNOTICE) << "Running: " << cmd.str();
+
+  int status = gSystem->Exec(cmd.str().c_str());
+  return status == 0 && utils::system::FileExists(filename);
+}
+//____________________________________________________________________________
+long CompareTrees(const string & filename1, const string & filename2)
+{
+// Returns the number of differing entries (missing entries count as
+// differing) and prints the first few of them
+
+  const long kNPrint = 5;
+
+  TFile file1(filename1.c_str(), "READ");
+  TFile file2(filename2.c_str(), "READ");
+  TTree * tree1 = dynamic_cast<TTree *> (file1.Get("gFlxIntProb"));
+  TTree * tree2 = dynamic_cast<TTree *> (file2.Get("gFlxIntProb"));
+  if(!tree1 || !tree2) {
+    LOG("test", pERROR) << "No flux interaction probability tree found";
+    return -1;
+  }
+
+  int    index[2], pdg[2];
+  double prob[2], enu[2], weight[2];
+  TTree * trees[2] = { tree1, tree2 };
+  for(int i = 0; i < 2; i++) {
+    trees[i]->SetBranchAddress("FluxIndex",   &index [i]);
+    trees[i]->SetBranchAddress("FluxPDG",     &pdg   [i]);
+    trees[i]->SetBranchAddress("FluxIntProb", &prob  [i]);
+    trees[i]->SetBranchAddress("FluxEnu",     &enu   [i]);
+    trees[i]->SetBranchAddress("FluxWeight",  &weight[i]);
+  }
+
+  long n1 = tree1->GetEntries();
+  long n2 = tree2->GetEntries();
+  long ndiff = TMath::Abs(n1 - n2);
+  if(ndiff > 0) {
+    LOG("test", pWARN) << "Number of entries: " << n1 << " vs " << n2;
+  }
+  for(long ie = 0; ie < TMath::Min(n1, n2); ie++) {
+    tree1->GetEntry(ie);
+    tree2->GetEntry(ie);
+    if(index[0] == index[1] && pdg[0] == pdg[1] && prob[0] == prob[1] &&
+       enu[0] == enu[1] && weight[0] == weight[1]) continue;
+    if(ndiff < kNPrint) {
+      LOG("test", pWARN)
+        << "Entry " << ie << " differs: (index, pdg, E, weight, P) = "
+        << "\n < (" << index[0] << ", " << pdg[0] << ", " << enu[0] << ", "
+        << weight[0] << ", " << prob[0] << ")"
+        << "\n > (" << index[1] << ", " << pdg[1] << ", " << enu[1] << ", "
+        << weight[1] << ", " << prob[1] << ")";
+    }
+    ndiff++;
+  }
+  return ndiff;
+}
+//____________________________________________________________________________
@@ -0,0 +1,409 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestINukeDeltaTracking
+
+\brief   Validates (and benchmarks) the delta tracking mode of the INTRANUKE
+         2018 hadron transport (INUKE-DeltaTracking) against the default
+         fixed-step transport.
+
+         Hadron+nucleus events are generated, on C12, Ar40 and Pb208 by
+         default, with both transport modes. For each nucleus the program
+         prints the hadron fate distributions and the mean final state
+         multiplicities in each mode, with the chi2 / pull comparing them,
+         and the CPU time per event. It returns a non-zero status if, for
+         any nucleus, the fate chi2 p-value is below the input minimum or a
+         multiplicity pull exceeds the input maximum (in absolute value).
+
+         The mean free path tables (INUKE-MFPTable) are also checked: for
+         each nucleus and hadron species (p, n, pi+, pi-, pi0, K+), the
+         tabulated mean free path is compared with the exact evaluation on
+         a (r, KE) grid placed between the table nodes, where the
+         interpolation error is largest. The program prints the largest
+         relative error in 1/mfp (and where it is found) and fails if it
+         exceeds the input tolerance. Points where the 1/mfp is below
+         1E-3 /fm (negligible interaction probability across the nucleus)
+         are not included.
+
+         The delta tracking mode samples the continuous-path limit of the
+         stepping algorithm, so the two agree up to effects of order of
+         the step size (INUKE-HadStep) on the interaction points.
+
+\syntax  gtestINukeDeltaTracking [-n nev] [-m mode] [-p probe_pdg] [-k ke]
+                                 [-t tgt_pdg[,tgt_pdg...]] [-r seed]
+                                 [--min-pvalue p] [--max-pull pull]
+                                 [--mfp-tolerance tol]
+                                 [--tune tune] [--message-thresholds xml_file]
+
+         Options:
+
+          -n  Number of events per nucleus & transport mode [default: 10000]
+          -m  INTRANUKE mode: hA2018 or hN2018 [default: hA2018]
+          -p  Incident hadron PDG code [default: 211]
+          -k  Incident hadron kinetic energy (GeV) [default: 0.3]
+          -t  Target PDG code(s) [default: 1000060120,1000180400,1000822080]
+          -r  Random number seed [default: 0]
+          --min-pvalue
+              Minimum fate chi2 p-value [default: 0.001]
+          --max-pull
+              Maximum |pull| of the mean multiplicities [default: 4]
+          --mfp-tolerance
+              Maximum relative error of the tabulated 1/mfp [default: 0.05]
+
+\author  GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+#include <TStopwatch.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Registry/Registry.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Physics/HadronTransport/Intranuke2018.h"
+#include "Physics/HadronTransport/INukeHadroData2018.h"
+#include "Physics/HadronTransport/INukeUtils2018.h"
+
+using std::string;
+using std::vector;
+using std::map;
+
+using namespace genie;
+
+const int kNMult = 4;
+const char * kMultName[kNMult] = { "p", "n", "pi+-", "pi0" };
+
+// summary of the events generated with one transport mode
+struct Sample {
+  Sample() : nev(0), time(0) {
+    for(int i = 0; i < kNMult; i++) { sum[i] = 0; sum2[i] = 0; }
+  }
+  int            nev;
+  double         time;          // CPU time (s)
+  map<int,long>  fates;         // rescattering code of the probe
+  double         sum [kNMult];  // final state multiplicities
+  double         sum2[kNMult];
+};
+
+namespace genie {
+// access to the INTRANUKE mean free path tables (friend of Intranuke2018)
+class IntranukeTester {
+public:
+  static double MaxMFPTableError (const Intranuke2018 * inuke,
+                                  int pdgc, int tgt, double & r, double & ke);
+};
+}
+
+const int kNMFPSpecies = 6;
+const int kMFPSpecies[kNMFPSpecies] = {
+  kPdgProton, kPdgNeutron, kPdgPiP, kPdgPiM, kPdgPi0, kPdgKP };
+
+EventRecord * InitializeEvent (int probe, int tgt, double ke);
+void          Generate        (const EventRecordVisitorI * intranuke,
+                               int probe, int tgt, double ke, int nev, Sample & s);
+bool          Compare         (const Sample & step, const Sample & delta,
+                               double min_pvalue, double max_pull);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  int    nev   = (parser.OptionExists('n')) ? parser.ArgAsInt('n')    : 10000;
+  string mode  = (parser.OptionExists('m')) ? parser.ArgAsString('m') : "hA2018";
+  int    probe = (parser.OptionExists('p')) ? parser.ArgAsInt('p')    : kPdgPiP;
+  double ke    = (parser.OptionExists('k')) ? parser.ArgAsDouble('k') : 0.3;
+  long   seed  = (parser.OptionExists('r')) ? parser.ArgAsLong('r')   : 0;
+  double min_pvalue =
+     (parser.OptionExists("min-pvalue")) ? parser.ArgAsDouble("min-pvalue") : 1E-3;
+  double max_pull =
+     (parser.OptionExists("max-pull"))   ? parser.ArgAsDouble("max-pull")   : 4.;
+  double mfp_tol =
+     (parser.OptionExists("mfp-tolerance")) ? parser.ArgAsDouble("mfp-tolerance") : 0.05;
+
+  vector<int> targets;
+  if(parser.OptionExists('t')) {
+    vector<string> tgtv = utils::str::Split(parser.ArgAsString('t'), ",");
+    for(unsigned int i = 0; i < tgtv.size(); i++) {
+      targets.push_back(atoi(tgtv[i].c_str()));
+    }
+  } else {
+    targets.push_back(1000060120); // C12
+    targets.push_back(1000180400); // Ar40
+    targets.push_back(1000822080); // Pb208
+  }
+
+  string sname = "";
+  if      (mode == "hA2018") sname = "genie::HAIntranuke2018";
+  else if (mode == "hN2018") sname = "genie::HNIntranuke2018";
+  else {
+    LOG("test", pFATAL) << "Invalid INTRANUKE mode: " << mode;
+    exit(1);
+  }
+
+  RunOpt::Instance()->BuildTune();
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(seed);
+
+  // two instances of the same INTRANUKE mode: stepping & delta tracking
+  AlgFactory * algf = AlgFactory::Instance();
+  EventRecordVisitorI * stepping =
+     dynamic_cast<EventRecordVisitorI *> (algf->AdoptAlgorithm(sname,"Default"));
+  EventRecordVisitorI * delta =
+     dynamic_cast<EventRecordVisitorI *> (algf->AdoptAlgorithm(sname,"Default"));
+  assert(stepping && delta);
+
+  Registry r(delta->GetConfig());
+  r.UnLock();
+  r.Set("INUKE-DeltaTracking", true);
+  delta->Configure(r);
+
+  bool ok = true;
+  for(unsigned int it = 0; it < targets.size(); it++) {
+    int tgt = targets[it];
+
+    LOG("test", pNOTICE)
+      << "*** " << PDGLibrary::Instance()->Find(probe)->GetName()
+      << " (KE = " << ke << " GeV) + "
+      << PDGLibrary::Instance()->Find(tgt)->GetName() << ", " << mode
+      << ", " << nev << " events per transport mode";
+
+    Sample ss, sd;
+    Generate(stepping, probe, tgt, ke, nev, ss);
+    Generate(delta,    probe, tgt, ke, nev, sd);
+    ok = Compare(ss, sd, min_pvalue, max_pull) && ok;
+
+    // mean free path tables vs exact evaluation
+    std::ostringstream out;
+    out << "\n Max relative error of the tabulated 1/mfp:";
+    const Intranuke2018 * inuke = dynamic_cast<const Intranuke2018 *> (stepping);
+    assert(inuke);
+    for(int is = 0; is < kNMFPSpecies; is++) {
+      double r = 0, kemfp = 0;
+      double err = IntranukeTester::MaxMFPTableError(
+                             inuke, kMFPSpecies[is], tgt, r, kemfp);
+      out << "\n  " << PDGLibrary::Instance()->Find(kMFPSpecies[is])->GetName()
+          << " : " << err << " (r = " << r << " fm, KE = " << kemfp << " MeV)";
+      if(err > mfp_tol) {
+        out << " - FAILED";
+        ok = false;
+      }
+    }
+    LOG("test", pNOTICE) << out.str();
+  }
+
+  delete stepping;
+  delete delta;
+
+  return (ok) ? 0 : 1;
+}
+//____________________________________________________________________________
+EventRecord * InitializeEvent(int probe, int tgt, double ke)
+{
+// as in gevgen_hadron: probe & target at rest, the vertex is set by INTRANUKE
+
+  EventRecord * evrec = new EventRecord();
+  evrec->AttachSummary(new Interaction);
+
+  TLorentzVector x4null(0.,0.,0.,0.);
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  double mh = pdglib->Find(probe)->Mass();
+  double M  = pdglib->Find(tgt  )->Mass();
+
+  double Eh  = mh + ke;
+  double pzh = TMath::Sqrt(TMath::Max(0.,Eh*Eh-mh*mh));
+  TLorentzVector p4h   (0.,0.,pzh,Eh);
+  TLorentzVector p4tgt (0.,0.,0., M);
+
+  evrec->AddParticle(probe, kIStInitialState, -1,-1,-1,-1, p4h,   x4null);
+  evrec->AddParticle(tgt,   kIStInitialState, -1,-1,-1,-1, p4tgt, x4null);
+
+  return evrec;
+}
+//____________________________________________________________________________
+void Generate(
+  const EventRecordVisitorI * intranuke,
+  int probe, int tgt, double ke, int nev, Sample & s)
+{
+  // warm-up (cross section data, majorant tables)
+  for(int i = 0; i < 100; i++) {
+    EventRecord * evrec = InitializeEvent(probe, tgt, ke);
+    intranuke->ProcessEventRecord(evrec);
+    delete evrec;
+  }
+
+  TStopwatch sw;
+  sw.Stop();
+  for(int i = 0; i < nev; i++) {
+    EventRecord * evrec = InitializeEvent(probe, tgt, ke);
+
+    sw.Start(false);
+    intranuke->ProcessEventRecord(evrec);
+    sw.Stop();
+
+    s.fates[evrec->Particle(0)->RescatterCode()]++;
+
+    int mult[kNMult] = { 0, 0, 0, 0 };
+    TObjArrayIter piter(evrec);
+    GHepParticle * p = 0;
+    while( (p = (GHepParticle *) piter.Next()) ) {
+      if(p->Status() != kIStStableFinalState) continue;
+      int pdgc = p->Pdg();
+      if      (pdgc == kPdgProton               ) mult[0]++;
+      else if (pdgc == kPdgNeutron              ) mult[1]++;
+      else if (pdgc == kPdgPiP || pdgc == kPdgPiM) mult[2]++;
+      else if (pdgc == kPdgPi0                  ) mult[3]++;
+    }
+    for(int im = 0; im < kNMult; im++) {
+      s.sum [im] += mult[im];
+      s.sum2[im] += mult[im]*mult[im];
+    }
+    s.nev++;
+    delete evrec;
+  }
+  s.time = sw.CpuTime();
+}
+//____________________________________________________________________________
+bool Compare(
+  const Sample & step, const Sample & delta, double min_pvalue, double max_pull)
+{
+// two-sample chi2 for the fate distributions (equal sample sizes) and
+// pulls for the mean final state multiplicities. Returns false if the
+// p-value or a pull is out of the input bounds.
+
+  bool ok = true;
+
+  std::ostringstream out;
+
+  map<int,long> fates(step.fates);
+  map<int,long>::const_iterator it = delta.fates.begin();
+  for( ; it != delta.fates.end(); ++it) fates[it->first];
+
+  double chi2 = 0;
+  int    ndf  = 0;
+  out << "\n Fates (rescattering code: stepping / delta tracking):";
+  for(it = fates.begin(); it != fates.end(); ++it) {
+    int  code = it->first;
+    long ns = (step .fates.count(code)) ? step .fates.find(code)->second : 0;
+    long nd = (delta.fates.count(code)) ? delta.fates.find(code)->second : 0;
+    out << "\n  " << code << " : " << ns << " / " << nd;
+    if(ns + nd > 0) {
+      chi2 += TMath::Power(ns-nd, 2) / (ns+nd);
+      ndf++;
+    }
+  }
+  ndf = TMath::Max(ndf-1, 1);
+  double pvalue = TMath::Prob(chi2,ndf);
+  out << "\n  chi2/ndf = " << chi2 << "/" << ndf
+      << " (p-value = " << pvalue << ")";
+  if(pvalue < min_pvalue) {
+    out << " - FAILED";
+    ok = false;
+  }
+
+  out << "\n Mean final state multiplicities (stepping / delta tracking):";
+  for(int im = 0; im < kNMult; im++) {
+    double ms  = step .sum[im] / step .nev;
+    double md  = delta.sum[im] / delta.nev;
+    double vs  = (step .sum2[im] / step .nev - ms*ms) / step .nev;
+    double vd  = (delta.sum2[im] / delta.nev - md*md) / delta.nev;
+    double err  = TMath::Sqrt(vs + vd);
+    double pull = (err > 0) ? (md-ms)/err : 0.;
+    out << "\n  " << kMultName[im] << " : " << ms << " / " << md
+        << " (pull = " << pull << ")";
+    if(TMath::Abs(pull) > max_pull) {
+      out << " - FAILED";
+      ok = false;
+    }
+  }
+
+  out << "\n CPU time per event: "
+      << 1E3 * step.time  / step.nev  << " ms (stepping) / "
+      << 1E3 * delta.time / delta.nev << " ms (delta tracking)";
+
+  LOG("test", pNOTICE) << out.str();
+
+  return ok;
+}
+//____________________________________________________________________________
+double genie::IntranukeTester::MaxMFPTableError(
+  const Intranuke2018 * inuke, int pdgc, int tgt, double & rerr, double & keerr)
+{
+// Largest relative difference between the tabulated and the exact 1/mfp
+// over the table range, at the mid points between the table nodes.
+// Points where the table defers to the exact evaluation are skipped.
+
+  const int    kNR     = 127;  // table radial intervals
+  const int    kNKE    = 159;  // table (log) KE intervals
+  const double kMuMin  = 1E-3; // 1/fm
+
+  inuke->fRemnA = pdg::IonPdgCodeToA(tgt);
+  inuke->fRemnZ = pdg::IonPdgCodeToZ(tgt);
+
+  double rmax  = inuke->MFPTableRMax();
+  double kemin = INukeHadroData2018::fMinKinEnergy;
+  double kemax = INukeHadroData2018::fMaxKinEnergyHN;
+  double M     = PDGLibrary::Instance()->Find(pdgc)->Mass();
+  string mode  = inuke->GetINukeMode();
+
+  double maxerr = 0;
+  rerr  = 0;
+  keerr = 0;
+  for(int ik = 0; ik < kNKE; ik++) {
+    double ke = kemin * TMath::Power(kemax/kemin, (ik+0.5)/kNKE);
+    double E  = M + ke * units::MeV;
+    double pz = TMath::Sqrt(TMath::Max(0., E*E - M*M));
+    TLorentzVector p4(0., 0., pz, E);
+    for(int ir = 0; ir < kNR; ir++) {
+      double r = rmax * (ir+0.5) / kNR;
+      TLorentzVector x4(0., 0., r, 0.);
+      GHepParticle p(pdgc, kIStHadronInTheNucleus, -1,-1,-1,-1, p4, x4);
+
+      // skip the points evaluated exactly anyway (Oset pions, hN E0 cutoff
+      // bin; a zero interpolated 1/mfp needs two zero nodes, ie only below
+      // the E0 cutoff where the exact 1/mfp is also zero)
+      double Lt = inuke->TabulatedMeanFreePath(&p);
+      if(Lt < 0) continue;
+      double Le = utils::intranuke2018::MeanFreePath(pdgc, x4, p4,
+                    inuke->fRemnA, inuke->fRemnZ, inuke->fDelRPion,
+                    inuke->fDelRNucleon, inuke->fUseOset, inuke->fAltOset,
+                    inuke->fXsecNNCorr, mode);
+      double mut = 1./Lt;
+      double mue = (Le > 0) ? 1./Le : 0.;
+      if(mue < kMuMin) continue;
+      double err = TMath::Abs(mut - mue) / mue;
+      if(err > maxerr) { maxerr = err; rerr = r; keerr = ke; }
+    }
+  }
+  return maxerr;
+}
+//____________________________________________________________________________
@@ -0,0 +1,316 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestKineEnvelope
+
+\brief   Benchmarks the adaptive envelope (AdaptiveEnvelope option) of the
+         kinematics generators derived from KineGeneratorWithCache against
+         the default flat envelope at the maximum differential xsec.
+
+         For the DIS, QEL and DFR kinematics generators, numu CC events on
+         a free nucleon are generated with both envelopes, at energies drawn
+         log-uniformly in the input range (the same energies in both modes),
+         so that each adaptive envelope serves a spread of energies within
+         its energy bin. For each the program prints the number of accepted
+         events per differential xsec evaluation, the xsec evaluations spent
+         in the first event (max xsec scan or envelope build) and the CPU
+         time per event, plus the mean Q2 in each mode, with the pull
+         comparing them, as a check that the two modes sample the same
+         distribution. It also prints the number of times the adaptive
+         envelopes were found below the differential xsec (and raised),
+         and returns a non-zero status if any envelope was raised.
+
+\syntax  gtestKineEnvelope [-n nev] [-e emin[,emax]] [-r seed]
+                           [--tune tune] [--message-thresholds xml_file]
+
+         Options:
+
+          -n  Number of events per generator & envelope [default: 20000]
+          -e  Neutrino energy range (GeV) [default: 1,10]
+          -r  Random number seed [default: 0]
+
+\author  GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <sstream>
+#include <string>
+
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Registry/Registry.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Physics/Common/KineEnvelope.h"
+
+using std::ostringstream;
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// a cross section algorithm counting the calls to the model it wraps
+class CountingXSec : public XSecAlgorithmI {
+public:
+  CountingXSec(const XSecAlgorithmI * model) :
+    XSecAlgorithmI("CountingXSec"), fModel(model), fNCalls(0) { }
+  double XSec (const Interaction * i, KinePhaseSpace_t k) const
+     { fNCalls++; return fModel->XSec(i,k); }
+  double Integral        (const Interaction * i) const { return fModel->Integral(i);        }
+  bool   ValidProcess    (const Interaction * i) const { return fModel->ValidProcess(i);    }
+  bool   ValidKinematics (const Interaction * i) const { return fModel->ValidKinematics(i); }
+  long   NCalls (void) const { return fNCalls; }
+  void   Reset  (void)       { fNCalls = 0;    }
+private:
+  const XSecAlgorithmI * fModel;
+  mutable long           fNCalls;
+};
+
+// an event generation thread serving the counting cross section algorithm
+class BenchThread : public EventGeneratorI {
+public:
+  BenchThread(const EventGeneratorI * evg, const XSecAlgorithmI * xsec) :
+    EventGeneratorI("BenchThread"), fEvg(evg), fXSec(xsec) { }
+  void ProcessEventRecord (GHepRecord *) const { }
+  const GVldContext &               ValidityContext  (void) const { return fEvg->ValidityContext();  }
+  const InteractionListGeneratorI * IntListGenerator (void) const { return fEvg->IntListGenerator(); }
+  const XSecAlgorithmI *            CrossSectionAlg  (void) const { return fXSec; }
+private:
+  const EventGeneratorI * fEvg;
+  const XSecAlgorithmI *  fXSec;
+};
+
+// summary of the events generated with one envelope
+struct Sample {
+  Sample() : nev(0), ncalls(0), ncalls_init(0), time(0), sumQ2(0), sumQ22(0) { }
+  long   nev;
+  long   ncalls;       // xsec evaluations (excluding the first event)
+  long   ncalls_init;  // xsec evaluations in the first event
+  double time;         // CPU time (s)
+  double sumQ2;
+  double sumQ22;
+};
+
+const int kNGen = 3;
+const char * kThread [kNGen] = { "DIS-CC", "QEL-CC", "DFR-CC" };
+const char * kKineGen[kNGen] = {
+  "genie::DISKinematicsGenerator", "genie::QELKinematicsGenerator",
+  "genie::DFRKinematicsGenerator" };
+const char * kKineCfg[kNGen] = { "CC-Default", "CC-Default", "Default" };
+
+// envelope energy bins (as in KineGeneratorWithCache)
+const double kNEnvelopeEBinsPerDecade = 20.;
+
+Interaction * BuildInteraction (int igen, double E);
+EventRecord * InitializeEvent  (int igen, double E);
+void          Generate         (const EventRecordVisitorI * kinegen, CountingXSec & xsec,
+                                int igen, double emin, double emax, int nev, Sample & s);
+void          Compare          (const Sample & flat, const Sample & adaptive);
+long          CountViolations  (const EventRecordVisitorI * kinegen,
+                                int igen, double emin, double emax);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  int    nev  = (parser.OptionExists('n')) ? parser.ArgAsInt('n')    : 20000;
+  long   seed = (parser.OptionExists('r')) ? parser.ArgAsLong('r')   : 0;
+  double emin = 1.;
+  double emax = 10.;
+  if(parser.OptionExists('e')) {
+    vector<double> erange = parser.ArgAsDoubleTokens('e', ",");
+    emin = erange[0];
+    emax = (erange.size() > 1) ? erange[1] : emin;
+  }
+
+  RunOpt::Instance()->BuildTune();
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(seed);
+
+  AlgFactory * algf = AlgFactory::Instance();
+
+  long nraised = 0;
+  for(int igen = 0; igen < kNGen; igen++) {
+
+    const EventGeneratorI * evg = dynamic_cast<const EventGeneratorI *> (
+         algf->GetAlgorithm("genie::EventGenerator", kThread[igen]));
+    assert(evg);
+
+    CountingXSec xsec(evg->CrossSectionAlg());
+    BenchThread  thread(evg, &xsec);
+    RunningThreadInfo::Instance()->UpdateRunningThread(&thread);
+
+    // two instances of the kinematics generator: flat & adaptive envelope
+    EventRecordVisitorI * flat = dynamic_cast<EventRecordVisitorI *> (
+         algf->AdoptAlgorithm(kKineGen[igen], kKineCfg[igen]));
+    EventRecordVisitorI * adaptive = dynamic_cast<EventRecordVisitorI *> (
+         algf->AdoptAlgorithm(kKineGen[igen], kKineCfg[igen]));
+    assert(flat && adaptive);
+
+    Registry r(adaptive->GetConfig());
+    r.UnLock();
+    r.Set("AdaptiveEnvelope", true);
+    adaptive->Configure(r);
+
+    LOG("test", pNOTICE)
+      << "*** " << kKineGen[igen] << " (" << kThread[igen] << ", E = "
+      << emin << " - " << emax << " GeV), " << nev << " events per envelope";
+
+    Sample sf, sa;
+    Generate(flat,     xsec, igen, emin, emax, nev, sf);
+    Generate(adaptive, xsec, igen, emin, emax, nev, sa);
+    Compare(sf, sa);
+    nraised += CountViolations(adaptive, igen, emin, emax);
+
+    delete flat;
+    delete adaptive;
+  }
+
+  if(nraised > 0) {
+    LOG("test", pERROR)
+      << "The adaptive envelopes were raised " << nraised << " times";
+    return 1;
+  }
+  return 0;
+}
+//____________________________________________________________________________
+Interaction * BuildInteraction(int igen, double E)
+{
+  switch(igen) {
+    case 0  : return Interaction::DISCC(kPdgTgtFreeP, kPdgProton,  kPdgNuMu, E);
+    case 1  : return Interaction::QELCC(kPdgTgtFreeN, kPdgNeutron, kPdgNuMu, E);
+    default : return Interaction::DFRCC(kPdgTgtFreeP, kPdgProton,  kPdgNuMu, E);
+  }
+}
+//____________________________________________________________________________
+EventRecord * InitializeEvent(int igen, double E)
+{
+// the initial state (probe & free nucleon target) is added to the event
+// record by the InitialStateAppender, as in event generation
+
+  static const EventRecordVisitorI * isapp =
+     dynamic_cast<const EventRecordVisitorI *> (AlgFactory::Instance()->
+         GetAlgorithm("genie::InitialStateAppender","Default"));
+  assert(isapp);
+
+  EventRecord * evrec = new EventRecord();
+  evrec->AttachSummary(BuildInteraction(igen, E));
+  isapp->ProcessEventRecord(evrec);
+
+  return evrec;
+}
+//____________________________________________________________________________
+void Generate(
+  const EventRecordVisitorI * kinegen, CountingXSec & xsec,
+  int igen, double emin, double emax, int nev, Sample & s)
+{
+  // same energies in both modes
+  TRandom3 rnd(1);
+
+  // first event: max xsec scan or envelope build
+  xsec.Reset();
+  EventRecord * evrec = InitializeEvent(igen, emax);
+  kinegen->ProcessEventRecord(evrec);
+  delete evrec;
+  s.ncalls_init = xsec.NCalls();
+
+  xsec.Reset();
+  TStopwatch sw;
+  sw.Stop();
+  for(int i = 0; i < nev; i++) {
+    double E = emin * TMath::Power(emax/emin, rnd.Rndm());
+    evrec = InitializeEvent(igen, E);
+
+    sw.Start(false);
+    kinegen->ProcessEventRecord(evrec);
+    sw.Stop();
+
+    double Q2 = evrec->Summary()->Kine().Q2(true);
+    s.sumQ2  += Q2;
+    s.sumQ22 += Q2*Q2;
+    s.nev++;
+    delete evrec;
+  }
+  s.ncalls = xsec.NCalls();
+  s.time   = sw.CpuTime();
+}
+//____________________________________________________________________________
+void Compare(const Sample & flat, const Sample & adaptive)
+{
+  ostringstream out;
+
+  out << "\n Accepted events per xsec evaluation (flat / adaptive): "
+      << double(flat.nev) / flat.ncalls << " / "
+      << double(adaptive.nev) / adaptive.ncalls;
+  out << "\n Xsec evaluations in the first event (flat / adaptive): "
+      << flat.ncalls_init << " / " << adaptive.ncalls_init;
+  out << "\n CPU time per event (flat / adaptive): "
+      << 1E3 * flat.time     / flat.nev     << " ms / "
+      << 1E3 * adaptive.time / adaptive.nev << " ms";
+
+  double mf  = flat.sumQ2     / flat.nev;
+  double ma  = adaptive.sumQ2 / adaptive.nev;
+  double vf  = (flat.sumQ22     / flat.nev     - mf*mf) / flat.nev;
+  double va  = (adaptive.sumQ22 / adaptive.nev - ma*ma) / adaptive.nev;
+  double err = TMath::Sqrt(vf + va);
+  out << "\n Mean Q2 (flat / adaptive): " << mf << " / " << ma
+      << " GeV^2 (pull = " << ((err > 0) ? (ma-mf)/err : 0.) << ")";
+
+  LOG("test", pNOTICE) << out.str();
+}
+//____________________________________________________________________________
+long CountViolations(
+  const EventRecordVisitorI * kinegen, int igen, double emin, double emax)
+{
+// Returns the number of times the adaptive envelopes of the energy bins in
+// the input range were raised
+
+  Cache * cache = Cache::Instance();
+  Interaction * interaction = BuildInteraction(igen, emin);
+
+  int  bmin = TMath::FloorNint(kNEnvelopeEBinsPerDecade * TMath::Log10(emin));
+  int  bmax = TMath::FloorNint(kNEnvelopeEBinsPerDecade * TMath::Log10(emax));
+  long nraised = 0;
+  int  nenv    = 0;
+  for(int ebin = bmin; ebin <= bmax; ebin++) {
+    ostringstream ekey;
+    ekey << "envelope@E-bin=" << ebin;
+    string key = cache->CacheBranchKey(
+                  kinegen->Id().Key(), interaction->AsString(), ekey.str());
+    KineEnvelope * envelope =
+              dynamic_cast<KineEnvelope *> (cache->FindCacheBranch(key));
+    if(!envelope) continue;
+    nenv++;
+    nraised += envelope->NRaised();
+  }
+  delete interaction;
+
+  LOG("test", pNOTICE)
+    << "\n Envelope violations (xsec > envelope): " << nraised
+    << " in " << nenv << " envelopes";
+
+  return nraised;
+}
+//____________________________________________________________________________
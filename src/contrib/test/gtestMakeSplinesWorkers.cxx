@@ -0,0 +1,141 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestMakeSplinesWorkers
+
+\brief   Checks that the cross section splines built by gmkspl do not depend
+         on the number of worker processes (--workers option).
+
+         gmkspl is run twice for the same initial states, with 1 worker and
+         with n workers, and the two output XML files are compared line by
+         line. The program prints the first differing lines, if any, and
+         returns a non-zero status if the files differ.
+
+\syntax  gtestMakeSplinesWorkers [-w nworkers] [-p nu_pdg[,nu_pdg...]]
+                                 [-t tgt_pdg[,tgt_pdg...]] [-n nknots]
+                                 [-e max_energy] [-o output_prefix]
+                                 [--tune tune] [--event-generator-list list]
+
+         Options:
+
+          -w  Number of worker processes of the second run [default: 4]
+          -p  Neutrino PDG code(s) [default: 14]
+          -t  Target PDG code(s) [default: 1000010010,1000000010,1000060120]
+          -n  Number of knots per spline [default: 30]
+          -e  Maximum spline energy (GeV) [default: 10]
+          -o  Prefix of the output XML files [default: gtestMakeSplinesWorkers]
+
+\author  GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <TSystem.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/SystemUtils.h"
+
+using std::ifstream;
+using std::ostringstream;
+using std::string;
+
+using namespace genie;
+
+bool RunMakeSplines (const string & options, int nworkers, const string & filename);
+long CompareFiles   (const string & filename1, const string & filename2);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  int    nworkers = (parser.OptionExists('w')) ? parser.ArgAsInt('w')       : 4;
+  string nus      = (parser.OptionExists('p')) ? parser.ArgAsString('p')    : "14";
+  string tgts     = (parser.OptionExists('t')) ? parser.ArgAsString('t')    :
+                                                 "1000010010,1000000010,1000060120";
+  int    nknots   = (parser.OptionExists('n')) ? parser.ArgAsInt('n')       : 30;
+  double emax     = (parser.OptionExists('e')) ? parser.ArgAsDouble('e')    : 10.;
+  string prefix   = (parser.OptionExists('o')) ? parser.ArgAsString('o')    :
+                                                 "gtestMakeSplinesWorkers";
+
+  ostringstream options;
+  options << " -p " << nus << " -t " << tgts << " -n " << nknots
+          << " -e " << emax << " --seed 1";
+  if(parser.OptionExists("tune")) {
+    options << " --tune " << parser.ArgAsString("tune");
+  }
+  if(parser.OptionExists("event-generator-list")) {
+    options << " --event-generator-list "
+            << parser.ArgAsString("event-generator-list");
+  }
+
+  string file1 = prefix + ".1worker.xml";
+  ostringstream filen;
+  filen << prefix << "." << nworkers << "workers.xml";
+
+  if(!RunMakeSplines(options.str(), 1,        file1     ) ||
+     !RunMakeSplines(options.str(), nworkers, filen.str())) {
+    LOG("test", pFATAL) << "gmkspl failed";
+    return 1;
+  }
+
+  long ndiff = CompareFiles(file1, filen.str());
+
+  LOG("test", pNOTICE)
+    << "Splines built with 1 and " << nworkers << " workers: "
+    << ((ndiff == 0) ? "identical" : "DIFFERENT")
+    << " (" << ndiff << " differing lines)";
+
+  return (ndiff == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+bool RunMakeSplines(const string & options, int nworkers, const string & filename)
+{
+  ostringstream cmd;
+  cmd << "gmkspl" << options << " --workers " << nworkers << " -o " << filename;
+
+  LOG("test", pNOTICE) << "Running: " << cmd.str();
+
+  int status = gSystem->Exec(cmd.str().c_str());
+  return status == 0 && utils::system::FileExists(filename);
+}
+//____________________________________________________________________________
+long CompareFiles(const string & filename1, const string & filename2)
+{
+// Returns the number of differing lines (a missing line counts as differing)
+// and prints the first few of them
+
+  const long kNPrint = 5;
+
+  ifstream file1(filename1.c_str());
+  ifstream file2(filename2.c_str());
+
+  long   ndiff = 0;
+  long   iline = 0;
+  string line1, line2;
+  while(true) {
+    bool ok1 = std::getline(file1, line1).good();
+    bool ok2 = std::getline(file2, line2).good();
+    if(!ok1 && !ok2) break;
+    iline++;
+    if(ok1 && ok2 && line1 == line2) continue;
+    if(ndiff < kNPrint) {
+      LOG("test", pWARN)
+        << "Line " << iline << " differs:"
+        << "\n < " << ((ok1) ? line1 : "(end of file)")
+        << "\n > " << ((ok2) ? line2 : "(end of file)");
+    }
+    ndiff++;
+  }
+  return ndiff;
+}
+//____________________________________________________________________________
@@ -0,0 +1,127 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestNBodyPhaseSpace
+
+\brief   Measures how often TGenPhaseSpace decay weights exceed the maximum
+         weight served by NBodyPhaseSpace, per decay multiplicity.
+
+         For each multiplicity n, nucleon + (n-1) pion decays are generated
+         at a spread of available kinetic energies (log-uniform between the
+         input limits), with a fresh NBodyPhaseSpace table and the masses
+         in the canonical order. The program counts the decays with a weight
+         above NBodyPhaseSpace::WeightMax(), evaluated before any bin is
+         raised, and prints the violation rate for each n. It returns a
+         non-zero status if any rate exceeds the input tolerance.
+         The default multiplicity range covers all tabulated multiplicities
+         (up to NBodyPhaseSpace::kMaxTabulatedN); larger n are served by
+         warm-up estimates.
+
+\syntax  gtestNBodyPhaseSpace [-n nmax] [-d ndecays] [-k nkine]
+                              [--tmin tmin] [--tmax tmax] [-f tolerance]
+
+         Options:
+
+          -n  Maximum decay multiplicity, up to 18
+              [default: NBodyPhaseSpace::kMaxTabulatedN]
+          -d  Number of decays per kinetic energy [default: 10000]
+          -k  Number of kinetic energies per multiplicity [default: 50]
+          -f  Tolerated violation rate [default: 1E-4]
+          --tmin, --tmax
+              Range of the available kinetic energy (GeV) [default: 0.01, 2]
+
+\author  GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <sstream>
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+#include <TGenPhaseSpace.h>
+#include <TRandom3.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  int    nmax    = (parser.OptionExists('n'))    ? parser.ArgAsInt('n')         :
+                                                   NBodyPhaseSpace::kMaxTabulatedN;
+  int    ndec    = (parser.OptionExists('d'))    ? parser.ArgAsInt('d')         : 10000;
+  int    nkine   = (parser.OptionExists('k'))    ? parser.ArgAsInt('k')         : 50;
+  double tol     = (parser.OptionExists('f'))    ? parser.ArgAsDouble('f')      : 1E-4;
+  double tmin    = (parser.OptionExists("tmin")) ? parser.ArgAsDouble("tmin")   : 0.01;
+  double tmax    = (parser.OptionExists("tmax")) ? parser.ArgAsDouble("tmax")   : 2.;
+
+  const int kNMax = 18;
+  nmax = TMath::Min(nmax, kNMax);
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  double mN  = pdglib->Find(kPdgProton)->Mass();
+  double mpi = pdglib->Find(kPdgPiP)->Mass();
+
+  NBodyPhaseSpace * psmax = NBodyPhaseSpace::Instance();
+  TRandom3 &        rnd   = RandomGen::Instance()->RndDec();
+  TGenPhaseSpace    generator;
+
+  std::ostringstream out;
+  bool ok = true;
+
+  for(int n = 3; n <= nmax; n++) {
+
+    double dmass[kNMax], mass[kNMax];
+    int    index[kNMax];
+    dmass[0] = mN;
+    double sum = mN;
+    for(int i = 1; i < n; i++) { dmass[i] = mpi; sum += mpi; }
+    NBodyPhaseSpace::SortMasses(n, dmass, mass, index);
+
+    psmax->Reset();
+
+    long ntot = 0;
+    long nviol = 0;
+    double rmax = 0; // largest w / WeightMax
+    for(int ik = 0; ik < nkine; ik++) {
+      double T = tmin * TMath::Power(tmax/tmin, rnd.Rndm());
+      TLorentzVector p4(0., 0., 0., sum + T);
+
+      if(!generator.SetDecay(p4, n, mass)) continue;
+      double wmax = psmax->WeightMax(p4.M(), n, mass);
+
+      for(int id = 0; id < ndec; id++) {
+        double w = generator.Generate();
+        ntot++;
+        if(w > wmax) nviol++;
+        rmax = TMath::Max(rmax, w/wmax);
+      }
+    }
+
+    double rate = (ntot > 0) ? double(nviol)/ntot : 0.;
+    if(rate > tol) ok = false;
+
+    out << "\n n = " << n << ": " << nviol << " / " << ntot
+        << " decays above the maximum weight (rate = " << rate
+        << ", max w/wmax = " << rmax << ")";
+  }
+
+  LOG("test", pNOTICE)
+    << "Maximum weight violations per multiplicity:" << out.str();
+
+  return (ok) ? 0 : 1;
+}
+//____________________________________________________________________________
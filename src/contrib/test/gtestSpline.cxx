@@ -0,0 +1,171 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestSpline
+
+\brief   Program used for testing / benchmarking GENIE's Spline evaluation.
+
+         Builds a cross section-like spline (log-spaced knots, y=0 below a
+         threshold) and compares Spline::Evaluate, single-point and batch,
+         against the TSpline3-based evaluation (bit-by-bit), at the knots and
+         at random points. Then times all three.
+         Also checks Spline::EvaluateIfLowerKnotNonZero against
+         Spline::ClosestKnotValueIsZero & Spline::Evaluate.
+         Also checks Spline::Max against a dense scan of random ranges.
+
+         Syntax:
+           gtestSpline [-k nknots] [-n npoints]
+
+\author  GENIE Collaboration
+
+\created October 15, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <vector>
+#include <cfloat>
+
+#include <TMath.h>
+#include <TSpline.h>
+#include <TStopwatch.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::vector;
+
+using namespace genie;
+
+double TSpline3Evaluate (const Spline & spl, double x);
+
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+  int nknots  = (parser.OptionExists('k')) ? parser.ArgAsInt('k') : 300;
+  int npoints = (parser.OptionExists('n')) ? parser.ArgAsInt('n') : 1000000;
+
+  // cross section-like spline: log-spaced knots in [0.01, 500] GeV,
+  // zero below an 1 GeV threshold, ~E at low and ~constant at high energy
+  double Emin = 0.01;
+  double Emax = 500.;
+  vector<double> E(nknots), xsec(nknots);
+  for(int i = 0; i < nknots; i++) {
+    E[i] = TMath::Exp(TMath::Log(Emin) +
+               i * (TMath::Log(Emax)-TMath::Log(Emin))/(nknots-1));
+    xsec[i] = (E[i] < 1.) ? 0. : (E[i]-1.)/(1.+0.1*(E[i]-1.));
+  }
+  Spline spl(nknots, &E[0], &xsec[0]);
+
+  RandomGen * rnd = RandomGen::Instance();
+  vector<double> x(npoints), y(npoints);
+  for(int i = 0; i < npoints; i++) {
+    x[i] = Emin * TMath::Power(Emax/Emin, rnd->RndGen().Rndm());
+  }
+
+  // Check against the TSpline3 evaluation
+  int nerr = 0;
+  for(int i = 0; i < nknots-1; i++) {
+    if(spl.Evaluate(E[i]) != TSpline3Evaluate(spl, E[i])) nerr++;
+  }
+  spl.Evaluate(npoints, &x[0], &y[0]);
+  for(int i = 0; i < npoints; i++) {
+    double yref = TSpline3Evaluate(spl, x[i]);
+    if(spl.Evaluate(x[i]) != yref || y[i] != yref) nerr++;
+  }
+  LOG("test", pNOTICE)
+    << "Number of evaluations differing from the TSpline3 ones: " << nerr;
+
+  // Check Spline::EvaluateIfLowerKnotNonZero against the TSpline3-based
+  // knot search, at the knots and at random points
+  int nerr_zero = 0;
+  for(int i = 0; i < nknots + npoints; i++) {
+    double xi = (i < nknots) ? E[i] : x[i-nknots];
+    double yref = (spl.ClosestKnotValueIsZero(xi,"-")) ? 0. : spl.Evaluate(xi);
+    if(spl.EvaluateIfLowerKnotNonZero(xi) != yref) nerr_zero++;
+  }
+  LOG("test", pNOTICE)
+    << "Number of EvaluateIfLowerKnotNonZero values differing from the "
+    << "ClosestKnotValueIsZero & Evaluate ones: " << nerr_zero;
+
+  // Check the maximum over random ranges (which may extend beyond the spline
+  // range) against a dense scan: it must bound the scan from above and be
+  // attained up to the scan resolution
+  int nerr_max = 0;
+  for(int i = 0; i < 1000; i++) {
+    double x1 = 0.5*Emin * TMath::Power(2.*Emax/(0.5*Emin), rnd->RndGen().Rndm());
+    double x2 = 0.5*Emin * TMath::Power(2.*Emax/(0.5*Emin), rnd->RndGen().Rndm());
+    double xmin = TMath::Min(x1,x2);
+    double xmax = TMath::Max(x1,x2);
+    double ymax = spl.Max(xmin, xmax);
+    double yscan = -DBL_MAX;
+    const int nscan = 10000;
+    for(int j = 0; j <= nscan; j++) {
+      yscan = TMath::Max(yscan, spl.Evaluate(xmin + j*(xmax-xmin)/nscan));
+    }
+    bool ok = (ymax >= yscan - 1E-12*TMath::Abs(yscan)) &&
+              (ymax <= yscan + 1E-3 *TMath::Abs(ymax));
+    if(!ok) nerr_max++;
+  }
+  LOG("test", pNOTICE)
+    << "Number of maxima inconsistent with a dense scan: " << nerr_max;
+  nerr += nerr_max;
+
+  // Timing
+  TStopwatch sw;
+  double sum = 0;
+
+  sw.Start();
+  for(int i = 0; i < npoints; i++) sum += TSpline3Evaluate(spl, x[i]);
+  sw.Stop();
+  double t_ref = sw.CpuTime();
+
+  sw.Start(true);
+  for(int i = 0; i < npoints; i++) sum += spl.Evaluate(x[i]);
+  sw.Stop();
+  double t_single = sw.CpuTime();
+
+  sw.Start(true);
+  spl.Evaluate(npoints, &x[0], &y[0]);
+  sw.Stop();
+  double t_batch = sw.CpuTime();
+
+  LOG("test", pNOTICE)
+    << "\n " << npoints << " evaluations of a spline with " << nknots << " knots:"
+    << "\n  - TSpline3          : " << t_ref    << " s"
+    << "\n  - Spline (single x) : " << t_single << " s"
+    << "\n  - Spline (batch)    : " << t_batch  << " s"
+    << "\n (checksum: " << sum << ")";
+
+  return (nerr == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+double TSpline3Evaluate(const Spline & spl, double x)
+{
+// The Spline::Evaluate algorithm, as implemented on top of TSpline3
+
+  if(!spl.IsWithinValidRange(x)) return 0;
+
+  TSpline3 * tspl = spl.GetAsTSpline();
+
+  int iknot = tspl->FindX(x);
+  if(iknot >= spl.NKnots()-1) iknot = spl.NKnots()-2;
+
+  double xn=0, yn=0, xp=0, yp=0;
+  tspl->GetKnot(iknot,   xn, yn);
+  tspl->GetKnot(iknot+1, xp, yp);
+
+  bool is0n = (TMath::Abs(yn) < 0.001*DBL_EPSILON);
+  bool is0p = (TMath::Abs(yp) < 0.001*DBL_EPSILON);
+
+  if(!is0p && !is0n) return tspl->Eval(x);
+  if( is0p &&  is0n) return 0;
+  if(is0n) return yp * (x-xn)/(xp-xn);
+  else     return yn * (x-xn)/(xp-xn);
+}
+//____________________________________________________________________________
@@ -0,0 +1,180 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestVoxelGeometry
+
+\brief   Compares the voxelised geometry driver (VoxelGeomAnalyzer) with the
+         exact ROOT geometry driver (ROOTGeomAnalyzer): path lengths for
+         random rays and the time needed to compute them.
+
+         Rays start from random points in the top volume bounding box and
+         have random (isotropic) directions.
+
+\syntax  gtestVoxelGeometry [-f geom] [-L length_units] [-D density_units]
+                            [-n nrays] [-s voxel_size] [-m samples]
+
+         Options:
+
+          -f  A ROOT file containing a ROOT/GEANT geometry description
+              [default: $GENIE/data/geo/samples/BoxWithLArPbLayers.root]
+          -L  Geometry length units [default: m]
+          -D  Geometry density units [default: kg_m3]
+          -n  Number of rays [default: 100000]
+          -s  Voxel size, in geometry length units
+              [default: 1/100 of the longest bounding box side]
+          -m  Sampling points per voxel side [default: 2]
+
+\author  GENIE Collaboration
+
+\created October 15, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include <TSystem.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+#include <TVector3.h>
+#include <TStopwatch.h>
+#include <TGeoManager.h>
+#include <TGeoVolume.h>
+#include <TGeoBBox.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/UnitUtils.h"
+#include "Tools/Geometry/ROOTGeomAnalyzer.h"
+#include "Tools/Geometry/VoxelGeomAnalyzer.h"
+
+using std::string;
+using std::vector;
+using std::map;
+
+using namespace genie;
+using namespace genie::constants;
+
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  string geom_file = (parser.OptionExists('f')) ?
+     parser.ArgAsString('f') :
+     string(gSystem->Getenv("GENIE")) +
+                        string("/data/geo/samples/BoxWithLArPbLayers.root");
+  string lunits  = (parser.OptionExists('L')) ? parser.ArgAsString('L') : "m";
+  string dunits  = (parser.OptionExists('D')) ? parser.ArgAsString('D') : "kg_m3";
+  int    nrays   = (parser.OptionExists('n')) ? parser.ArgAsInt('n')    : 100000;
+  double vsize   = (parser.OptionExists('s')) ? parser.ArgAsDouble('s') : -1;
+  int    samples = (parser.OptionExists('m')) ? parser.ArgAsInt('m')    : 2;
+
+#ifdef __GENIE_GEOM_DRIVERS_ENABLED__
+
+  double lu = utils::units::UnitFromString(lunits);
+  double du = utils::units::UnitFromString(dunits);
+
+  geometry::ROOTGeomAnalyzer exact(geom_file);
+  exact.SetLengthUnits (lu);
+  exact.SetDensityUnits(du);
+
+  geometry::VoxelGeomAnalyzer voxel(exact.GetGeometry());
+  voxel.SetLengthUnits  (lu);
+  voxel.SetDensityUnits (du);
+  voxel.SetVoxelSize    (vsize);
+  voxel.SetVoxelSamples (samples);
+
+  TStopwatch sw;
+  sw.Start();
+  voxel.BuildVoxelGrid();
+  sw.Stop();
+  double t_build = sw.CpuTime();
+
+  // random rays through the top volume bounding box (SI units)
+  TGeoBBox * box =
+     (TGeoBBox *) exact.GetGeometry()->GetTopVolume()->GetShape();
+  double half[3] = { box->GetDX(), box->GetDY(), box->GetDZ() };
+  const double * origin = box->GetOrigin();
+  double scale = lu/units::meter;
+
+  RandomGen * rnd = RandomGen::Instance();
+  vector<TLorentzVector> x4(nrays), p4(nrays);
+  for(int i = 0; i < nrays; i++) {
+    TVector3 x;
+    for(int k = 0; k < 3; k++) {
+      x[k] = scale * (origin[k] + half[k] * (2*rnd->RndGeom().Rndm()-1));
+    }
+    double costh = 2*rnd->RndGeom().Rndm()-1;
+    double phi   = 2*kPi*rnd->RndGeom().Rndm();
+    TVector3 dir(0,0,1);
+    dir.SetMagThetaPhi(1., TMath::ACos(costh), phi);
+    x4[i].SetVect(x);
+    p4[i].SetVectMag(dir, 0.);
+  }
+
+  // compare the path lengths
+  map<int,double> sum_exact, sum_dev, max_dev, max_pl;
+  for(int i = 0; i < nrays; i++) {
+    PathLengthList pl_exact(exact.ComputePathLengths(x4[i],p4[i]));
+    const PathLengthList & pl_voxel = voxel.ComputePathLengths(x4[i],p4[i]);
+    PathLengthList::const_iterator it = pl_exact.begin();
+    for( ; it != pl_exact.end(); ++it) {
+      int    pdgc = it->first;
+      double dev  = TMath::Abs(pl_voxel.PathLength(pdgc) - it->second);
+      sum_exact[pdgc] += it->second;
+      sum_dev  [pdgc] += dev;
+      max_dev  [pdgc]  = TMath::Max(max_dev[pdgc], dev);
+      max_pl   [pdgc]  = TMath::Max(max_pl [pdgc], it->second);
+    }
+  }
+  map<int,double>::const_iterator it = sum_exact.begin();
+  for( ; it != sum_exact.end(); ++it) {
+    int pdgc = it->first;
+    LOG("test", pNOTICE)
+      << "Target: " << pdgc
+      << ": mean path length = " << it->second/nrays
+      << ", mean |voxel - exact| = " << sum_dev[pdgc]/nrays
+      << ", max |voxel - exact| = " << max_dev[pdgc]
+      << " (max path length = " << max_pl[pdgc] << ")";
+  }
+
+  // timing
+  double sum = 0;
+
+  sw.Start(true);
+  for(int i = 0; i < nrays; i++) {
+    sum += exact.ComputePathLengths(x4[i],p4[i]).begin()->second;
+  }
+  sw.Stop();
+  double t_exact = sw.CpuTime();
+
+  sw.Start(true);
+  for(int i = 0; i < nrays; i++) {
+    sum += voxel.ComputePathLengths(x4[i],p4[i]).begin()->second;
+  }
+  sw.Stop();
+  double t_voxel = sw.CpuTime();
+
+  LOG("test", pNOTICE)
+    << "\n Path lengths for " << nrays << " rays:"
+    << "\n  - ROOTGeomAnalyzer  : " << t_exact << " s"
+    << "\n  - VoxelGeomAnalyzer : " << t_voxel << " s"
+    << " (+ " << t_build << " s to build the voxel grid)"
+    << "\n (checksum: " << sum << ")";
+
+#else
+  LOG("test", pERROR)
+     << "*** You should have enabled the geometry drivers first!";
+#endif
+
+  return 0;
+}
+//____________________________________________________________________________